@@ -0,0 +1,645 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include <errno.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+#include <sys/stat.h>  // si pe Windows (stat pentru .bin mai vechi decat .txt)
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "dictionary.h"
+#include "log.h"
+
+// Starea scanarii: se parcurge fisierul o singura data, se copiaza in arena cu litere mari
+// si la fiecare '\n' se inchide cuvantul curent.
+typedef struct DictionaryScan {
+    Dictionary* dict;
+    size_t line_start;      // inceputul liniei curente in arena
+    bool line_bad;          // linia curenta are caractere care nu sunt litere
+    int capacity;           // cate offset-uri incap in dict->offsets
+    int skipped;            // linii ignorate (prea lungi sau cu alte caractere)
+    bool failed;
+    DictionaryProgressCallback progress;
+    void* progress_data;
+} DictionaryScan;
+
+#ifndef DICTIONARY_SCAN_CHUNK
+#define DICTIONARY_SCAN_CHUNK (1 << 20)   // la fiecare MB se raporteaza progresul
+#endif
+#define DICTIONARY_SCAN_PERMILLE 900       // restul pana la 1000 e construirea indexului
+
+unsigned int dictionary_letter_mask(const char* word, size_t length) {
+    unsigned int mask = 0;
+    for (size_t i = 0; i < length; i++) {
+        mask |= 1u << (word[i] - 'A');
+    }
+    return mask;
+}
+
+static void dictionary_scan_finish_line(DictionaryScan* scan, size_t end) {
+    Dictionary* dict = scan->dict;
+    size_t start = scan->line_start;
+    bool bad = scan->line_bad;
+    scan->line_start = end + 1;
+    scan->line_bad = false;
+
+    dict->arena[end] = '\0';
+    if (end > start && dict->arena[end - 1] == '\r') { // fisiere salvate pe Windows
+        end--;
+        dict->arena[end] = '\0';
+    }
+    size_t len = end - start;
+    if (len == 0) {
+        return;
+    }
+    if (bad || len > WORD_INDEX_MAX_LENGTH) {
+        scan->skipped++;
+        return;
+    }
+
+    if (dict->word_count == scan->capacity) {
+        int new_capacity = scan->capacity * 2;
+        unsigned int* offsets = (unsigned int*)realloc(dict->offsets, new_capacity * sizeof(unsigned int));
+        unsigned char* lengths = (unsigned char*)realloc(dict->lengths, new_capacity);
+        unsigned int* masks = (unsigned int*)realloc(dict->letter_masks, new_capacity * sizeof(unsigned int));
+        if (offsets) dict->offsets = offsets;
+        if (lengths) dict->lengths = lengths;
+        if (masks) dict->letter_masks = masks;
+        if (!offsets || !lengths || !masks) {
+            scan->failed = true;
+            return;
+        }
+        scan->capacity = new_capacity;
+    }
+    dict->offsets[dict->word_count] = (unsigned int)start;
+    dict->lengths[dict->word_count] = (unsigned char)len;
+    dict->letter_masks[dict->word_count] = dictionary_letter_mask(dict->arena + start, len);
+    dict->word_count++;
+}
+
+static void dictionary_scan_byte(DictionaryScan* scan, size_t pos, unsigned char c) {
+    if (c >= 'a' && c <= 'z') {
+        c = c - 32; //transform fiecare litera in litera mare
+    }
+    scan->dict->arena[pos] = (char)c;
+    if (c == '\n') {
+        dictionary_scan_finish_line(scan, pos);
+    } else if ((c < 'A' || c > 'Z') && c != '\r') {
+        scan->line_bad = true;
+    }
+}
+
+// Un '\r' e acceptat doar chiar inainte de '\n'; in rest linia e invalida.
+static void dictionary_scan_check_cr(DictionaryScan* scan, const unsigned char* src, size_t pos, size_t size) {
+    if (pos + 1 < size && src[pos + 1] != '\n') {
+        scan->line_bad = true;
+    }
+}
+
+// Scaneaza [begin, end); size e folosit doar pentru a privi dupa '\r' peste capatul bucatii.
+static void dictionary_scan_range(DictionaryScan* scan, const unsigned char* src, size_t begin, size_t end, size_t size) {
+    size_t i = begin;
+
+#ifdef __SSE2__
+    char* dst = scan->dict->arena;
+    // 16 octeti odata: litere mari, masca de '\n' si masca de caractere invalide
+    const __m128i before_a = _mm_set1_epi8('a' - 1);
+    const __m128i after_z = _mm_set1_epi8('z' + 1);
+    const __m128i before_upper_a = _mm_set1_epi8('A' - 1);
+    const __m128i after_upper_z = _mm_set1_epi8('Z' + 1);
+    const __m128i case_bit = _mm_set1_epi8(0x20);
+    const __m128i newline = _mm_set1_epi8('\n');
+    const __m128i carriage_return = _mm_set1_epi8('\r');
+
+    for (; i + 16 <= end && !scan->failed; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(src + i));
+        __m128i is_lower = _mm_and_si128(_mm_cmpgt_epi8(v, before_a), _mm_cmplt_epi8(v, after_z));
+        v = _mm_sub_epi8(v, _mm_and_si128(is_lower, case_bit));
+        _mm_storeu_si128((__m128i*)(dst + i), v);
+
+        __m128i is_upper = _mm_and_si128(_mm_cmpgt_epi8(v, before_upper_a), _mm_cmplt_epi8(v, after_upper_z));
+        unsigned int nl = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(v, newline));
+        unsigned int cr = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(v, carriage_return));
+        unsigned int bad = ~(unsigned int)_mm_movemask_epi8(is_upper) & 0xFFFFu & ~nl & ~cr;
+
+        if ((nl | bad | cr) == 0) {
+            continue; // cazul cel mai des: 16 litere din mijlocul unui cuvant
+        }
+        // '\r' urmat de '\n' e normal; '\r' de pe ultimul octet se verifica separat
+        bad |= cr & ~(nl >> 1) & 0x7FFFu;
+        if ((cr & 0x8000u) && i + 16 < size && src[i + 16] != '\n') {
+            bad |= 0x8000u;
+        }
+
+        unsigned int consumed = 0;
+        while (nl) {
+            unsigned int bit = (unsigned int)__builtin_ctz(nl);
+            unsigned int below = (1u << bit) - 1;
+            if (bad & below & ~consumed) {
+                scan->line_bad = true;
+            }
+            dictionary_scan_finish_line(scan, i + bit);
+            consumed = below | (1u << bit);
+            nl &= nl - 1;
+        }
+        if (bad & ~consumed) {
+            scan->line_bad = true;
+        }
+    }
+#endif
+
+    for (; i < end && !scan->failed; i++) {
+        dictionary_scan_byte(scan, i, src[i]);
+        if (src[i] == '\r') {
+            dictionary_scan_check_cr(scan, src, i, size);
+        }
+    }
+}
+
+static void dictionary_scan(DictionaryScan* scan, const unsigned char* src, size_t size) {
+    for (size_t begin = 0; begin < size && !scan->failed; begin += DICTIONARY_SCAN_CHUNK) {
+        size_t end = (size - begin > DICTIONARY_SCAN_CHUNK) ? begin + DICTIONARY_SCAN_CHUNK : size;
+        dictionary_scan_range(scan, src, begin, end, size);
+        if (scan->progress) {
+            scan->progress((int)((double)end / size * DICTIONARY_SCAN_PERMILLE), scan->progress_data);
+        }
+    }
+    // ultima linie poate sa nu aiba '\n'; arena are un octet in plus pentru '\0'
+    if (!scan->failed && scan->line_start < size) {
+        dictionary_scan_finish_line(scan, size);
+    }
+}
+
+// Fisierul e mapat read-only in memorie (pe Windows e citit cu un singur fread).
+static const unsigned char* dictionary_map_file(const char* filename, size_t* size_out) {
+    const unsigned char* data = NULL;
+    size_t size = 0;
+
+#ifdef _WIN32
+    FILE* file = fopen(filename, "rb");
+    if (!file) {
+        LOG_ERROR(LOG_CAT_DICT, "dictionary_map_file: Cannot open %s: %s", filename, strerror(errno));
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    long file_size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    unsigned char* buffer = (file_size > 0) ? (unsigned char*)malloc((size_t)file_size) : NULL;
+    if (buffer) {
+        size = fread(buffer, 1, (size_t)file_size, file);
+    }
+    fclose(file);
+    data = buffer;
+#else
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) {
+        LOG_ERROR(LOG_CAT_DICT, "dictionary_map_file: Cannot open %s: %s", filename, strerror(errno));
+        return NULL;
+    }
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        size = (size_t)st.st_size;
+        // MAP_SHARED read-only: mai multe procese ale jocului impart aceleasi pagini fizice
+        void* mapping = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+        if (mapping == MAP_FAILED) {
+            LOG_ERROR(LOG_CAT_DICT, "dictionary_map_file: mmap failed for %s: %s", filename, strerror(errno));
+            size = 0;
+        } else {
+            data = (const unsigned char*)mapping;
+        }
+    }
+    close(fd);
+#endif
+
+    if (data == NULL || size == 0) {
+        LOG_ERROR(LOG_CAT_DICT, "dictionary_map_file: %s is empty or unreadable.", filename);
+#ifdef _WIN32
+        free((void*)data);
+#endif
+        return NULL;
+    }
+    *size_out = size;
+    return data;
+}
+
+static void dictionary_unmap_file(const unsigned char* data, size_t size) {
+    if (data == NULL) {
+        return;
+    }
+#ifdef _WIN32
+    (void)size;
+    free((void*)data);
+#else
+    munmap((void*)data, size);
+#endif
+}
+
+static bool dictionary_load_text_internal(Dictionary* dict, const char* filename,
+                                          DictionaryProgressCallback progress, void* progress_data) {
+    if (dict == NULL || filename == NULL) {
+        LOG_ERROR(LOG_CAT_DICT, "dictionary_load_text: Dictionary or filename is NULL.");
+        return false;
+    }
+    memset(dict, 0, sizeof(Dictionary));
+
+    size_t size = 0;
+    const unsigned char* data = dictionary_map_file(filename, &size);
+    if (data == NULL) {
+        return false;
+    }
+#ifdef MADV_SEQUENTIAL
+    madvise((void*)data, size, MADV_SEQUENTIAL);
+#endif
+
+    // arena are exact dimensiunea fisierului (+1 pentru '\0' la final), un singur malloc
+    DictionaryScan scan = {0};
+    scan.dict = dict;
+    scan.progress = progress;
+    scan.progress_data = progress_data;
+    scan.capacity = (int)(size / 8) + 16;
+    dict->arena_size = size + 1;
+    dict->arena = (char*)malloc(dict->arena_size);
+    dict->offsets = (unsigned int*)malloc(scan.capacity * sizeof(unsigned int));
+    dict->lengths = (unsigned char*)malloc(scan.capacity);
+    dict->letter_masks = (unsigned int*)malloc(scan.capacity * sizeof(unsigned int));
+    if (!dict->arena || !dict->offsets || !dict->lengths || !dict->letter_masks) {
+        scan.failed = true;
+    } else {
+        dictionary_scan(&scan, data, size);
+    }
+    dictionary_unmap_file(data, size);
+
+    if (scan.failed) {
+        LOG_ERROR(LOG_CAT_DICT, "dictionary_load_text: Out of memory while loading %s.", filename);
+        dictionary_free(dict);
+        return false;
+    }
+    if (dict->word_count == 0) {
+        LOG_ERROR(LOG_CAT_DICT, "dictionary_load_text: No words found in %s.", filename);
+        dictionary_free(dict);
+        return false;
+    }
+    if (scan.skipped > 0) {
+        LOG_WARN(LOG_CAT_DICT, "dictionary_load_text: Skipped %d lines in %s (longer than %d letters or not A-Z).",
+                scan.skipped, filename, WORD_INDEX_MAX_LENGTH);
+    }
+
+    if (!word_index_build(&dict->index, dict->lengths, dict->word_count)) {
+        dictionary_free(dict);
+        return false;
+    }
+    dict->words_checksum = dictionary_words_checksum(dict); // o data aici; .bin-ul il are in header
+    if (progress) {
+        progress(1000, progress_data);
+    }
+    return true;
+}
+
+bool dictionary_load_text(Dictionary* dict, const char* filename) {
+    return dictionary_load_text_internal(dict, filename, NULL, NULL);
+}
+
+// --- Formatul binar (.bin) ---
+// [header][arena][offsets u32][lengths u8][letter_masks u32][order i32], sectiunile aliniate la 8 octeti.
+// Totul e deja normalizat si indexat, asa ca incarcarea inseamna doar mmap + cateva verificari.
+
+uint32_t dictionary_checksum(const unsigned char* data, size_t size) {
+    uint32_t hash = 2166136261u; // FNV-1a
+    for (size_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static size_t dictionary_align8(size_t value) {
+    return (value + 7) & ~(size_t)7;
+}
+
+static bool dictionary_section_ok(uint64_t offset, uint64_t bytes, size_t file_size) {
+    return offset % 4 == 0 && offset <= file_size && bytes <= file_size - offset;
+}
+
+static bool dictionary_buckets_ok(const int32_t* bucket_start, int32_t count) {
+    for (int len = 1; len <= WORD_INDEX_MAX_LENGTH; len++) {
+        if (bucket_start[len] < 0 || bucket_start[len] > bucket_start[len + 1]) {
+            return false;
+        }
+    }
+    return bucket_start[WORD_INDEX_MAX_LENGTH + 1] <= count;
+}
+
+bool dictionary_load_binary(Dictionary* dict, const char* filename) {
+    if (dict == NULL || filename == NULL) {
+        LOG_ERROR(LOG_CAT_DICT, "dictionary_load_binary: Dictionary or filename is NULL.");
+        return false;
+    }
+    memset(dict, 0, sizeof(Dictionary));
+
+    size_t size = 0;
+    const unsigned char* data = dictionary_map_file(filename, &size);
+    if (data == NULL) {
+        return false;
+    }
+
+    const DictionaryFileHeader* header = (const DictionaryFileHeader*)data;
+    uint64_t count = (size >= sizeof(DictionaryFileHeader)) ? header->word_count : 0;
+    if (size < sizeof(DictionaryFileHeader) ||
+        memcmp(header->magic, DICTIONARY_FILE_MAGIC, sizeof(header->magic)) != 0 ||
+        header->version != DICTIONARY_FILE_VERSION ||
+        header->header_size != sizeof(DictionaryFileHeader) ||
+        header->max_word_length != WORD_INDEX_MAX_LENGTH ||
+        count == 0 || count > 0x7FFFFFFF ||
+        !dictionary_section_ok(header->arena_offset, header->arena_size, size) ||
+        !dictionary_section_ok(header->offsets_offset, count * sizeof(uint32_t), size) ||
+        !dictionary_section_ok(header->lengths_offset, count, size) ||
+        !dictionary_section_ok(header->masks_offset, count * sizeof(uint32_t), size) ||
+        !dictionary_section_ok(header->order_offset, count * sizeof(int32_t), size) ||
+        !dictionary_buckets_ok(header->bucket_start, (int32_t)count)) {
+        LOG_ERROR(LOG_CAT_DICT, "dictionary_load_binary: %s is not a valid version %d dictionary.", filename, DICTIONARY_FILE_VERSION);
+        dictionary_unmap_file(data, size);
+        return false;
+    }
+#ifdef DICTIONARY_VERIFY_CHECKSUM
+    // citeste tot fisierul, deci doar la cerere; tools/dict_compile --verify face acelasi lucru offline
+    if (dictionary_checksum(data + header->header_size, size - header->header_size) != header->checksum) {
+        LOG_ERROR(LOG_CAT_DICT, "dictionary_load_binary: Checksum mismatch in %s.", filename);
+        dictionary_unmap_file(data, size);
+        return false;
+    }
+#endif
+
+    dict->mapping = data;
+    dict->mapping_size = size;
+    dict->word_count = (int)count;
+    dict->arena = (char*)(data + header->arena_offset);
+    dict->arena_size = (size_t)header->arena_size;
+    dict->words_checksum = header->words_checksum;
+    dict->offsets = (unsigned int*)(data + header->offsets_offset);
+    dict->lengths = (unsigned char*)(data + header->lengths_offset);
+    dict->letter_masks = (unsigned int*)(data + header->masks_offset);
+    dict->index.order = (int*)(data + header->order_offset);
+    for (int len = 0; len < WORD_INDEX_MAX_LENGTH + 2; len++) {
+        dict->index.bucket_start[len] = header->bucket_start[len];
+    }
+    for (int len = 1; len <= WORD_INDEX_MAX_LENGTH; len++) {
+        if (dict->index.bucket_start[len + 1] > dict->index.bucket_start[len]) {
+            dict->index.available_lengths[dict->index.available_count++] = len;
+        }
+    }
+#ifdef DICTIONARY_VERIFY_CHECKSUM
+    if (!dictionary_verify_tables(dict)) {
+        LOG_ERROR(LOG_CAT_DICT, "dictionary_load_binary: %s has inconsistent word tables.", filename);
+        dictionary_free(dict);
+        return false;
+    }
+#endif
+    return true;
+}
+
+// O trecere O(n) care citeste toata arena si tabelele, deci nu e pe drumul normal de incarcare (acolo
+// dictionary_word doar limiteaza indicele si offset-ul); o fac dict_compile --verify si DICTIONARY_VERIFY_CHECKSUM.
+bool dictionary_verify_tables(const Dictionary* dict) {
+    for (int i = 0; i < dict->word_count; i++) {
+        if (dict->lengths[i] < 1 || dict->lengths[i] > WORD_INDEX_MAX_LENGTH ||
+            (uint64_t)dict->offsets[i] + dict->lengths[i] >= dict->arena_size ||
+            dict->arena[dict->offsets[i] + dict->lengths[i]] != '\0') {
+            return false;
+        }
+    }
+    // fiecare bucket trimite doar la cuvinte de lungimea lui
+    for (int len = 1; len <= WORD_INDEX_MAX_LENGTH; len++) {
+        for (int i = dict->index.bucket_start[len]; i < dict->index.bucket_start[len + 1]; i++) {
+            int word = dict->index.order[i];
+            if (word < 0 || word >= dict->word_count || dict->lengths[word] != len) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool dictionary_write_binary(const Dictionary* dict, const char* filename) {
+    if (dict == NULL || filename == NULL || dict->word_count == 0) {
+        LOG_ERROR(LOG_CAT_DICT, "dictionary_write_binary: Nothing to write.");
+        return false;
+    }
+    size_t count = (size_t)dict->word_count;
+    int indexed = dict->index.bucket_start[WORD_INDEX_MAX_LENGTH + 1];
+
+    DictionaryFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, DICTIONARY_FILE_MAGIC, sizeof(header.magic));
+    header.version = DICTIONARY_FILE_VERSION;
+    header.header_size = sizeof(DictionaryFileHeader);
+    header.word_count = (uint32_t)count;
+    header.max_word_length = WORD_INDEX_MAX_LENGTH;
+    header.words_checksum = dict->words_checksum;
+    for (int len = 0; len < WORD_INDEX_MAX_LENGTH + 2; len++) {
+        header.bucket_start[len] = dict->index.bucket_start[len];
+    }
+
+    // arena se rescrie compact: doar cuvintele valide, fiecare cu '\0'
+    size_t arena_size = 0;
+    for (size_t i = 0; i < count; i++) {
+        arena_size += dict->lengths[i] + 1;
+    }
+    size_t offset = dictionary_align8(sizeof(DictionaryFileHeader));
+    header.arena_offset = offset;
+    header.arena_size = arena_size;
+    offset = dictionary_align8(offset + arena_size);
+    header.offsets_offset = offset;
+    offset = dictionary_align8(offset + count * sizeof(uint32_t));
+    header.lengths_offset = offset;
+    offset = dictionary_align8(offset + count);
+    header.masks_offset = offset;
+    offset = dictionary_align8(offset + count * sizeof(uint32_t));
+    header.order_offset = offset;
+    offset = dictionary_align8(offset + count * sizeof(int32_t));
+    size_t file_size = offset;
+
+    unsigned char* image = (unsigned char*)calloc(1, file_size);
+    if (!image) {
+        LOG_ERROR(LOG_CAT_DICT, "dictionary_write_binary: Failed to allocate %zu bytes.", file_size);
+        return false;
+    }
+    char* arena = (char*)(image + header.arena_offset);
+    uint32_t* offsets = (uint32_t*)(image + header.offsets_offset);
+    unsigned char* lengths = image + header.lengths_offset;
+    uint32_t* masks = (uint32_t*)(image + header.masks_offset);
+    int32_t* order = (int32_t*)(image + header.order_offset);
+    size_t arena_pos = 0;
+    for (size_t i = 0; i < count; i++) {
+        offsets[i] = (uint32_t)arena_pos;
+        memcpy(arena + arena_pos, dictionary_word(dict, (int)i), dict->lengths[i]);
+        arena_pos += dict->lengths[i] + 1;
+        lengths[i] = dict->lengths[i];
+        masks[i] = dict->letter_masks[i];
+    }
+    for (int i = 0; i < indexed; i++) {
+        order[i] = dict->index.order[i];
+    }
+
+    header.checksum = dictionary_checksum(image + sizeof(DictionaryFileHeader), file_size - sizeof(DictionaryFileHeader));
+    memcpy(image, &header, sizeof(header));
+
+    FILE* file = fopen(filename, "wb");
+    if (!file) {
+        LOG_ERROR(LOG_CAT_DICT, "dictionary_write_binary: Cannot create %s: %s", filename, strerror(errno));
+        free(image);
+        return false;
+    }
+    bool ok = fwrite(image, 1, file_size, file) == file_size;
+    ok = (fclose(file) == 0) && ok;
+    free(image);
+    if (!ok) {
+        LOG_ERROR(LOG_CAT_DICT, "dictionary_write_binary: Failed to write %s.", filename);
+    }
+    return ok;
+}
+
+// .bin-ul e mai vechi decat .txt-ul din care a fost compilat: lista a fost editata fara dict_compile
+static bool dictionary_binary_is_stale(const char* binary_filename, const char* text_filename) {
+    struct stat binary_stat;
+    struct stat text_stat;
+    if (text_filename == NULL || stat(binary_filename, &binary_stat) != 0 || stat(text_filename, &text_stat) != 0) {
+        return false; // fara .txt, .bin-ul e singura sursa
+    }
+    return text_stat.st_mtime > binary_stat.st_mtime;
+}
+
+// progress (optional) e apelat pe firul care incarca, cu valori 0..1000
+bool dictionary_load_with_progress(Dictionary* dict, const char* binary_filename, const char* text_filename,
+                                   DictionaryProgressCallback progress, void* progress_data) {
+    if (binary_filename) {
+        FILE* probe = fopen(binary_filename, "rb");
+        if (probe) {
+            fclose(probe);
+            if (dictionary_binary_is_stale(binary_filename, text_filename)) {
+                LOG_WARN(LOG_CAT_DICT, "dictionary_load: %s is older than %s (rerun dict_compile).",
+                         binary_filename, text_filename);
+            } else if (dictionary_load_binary(dict, binary_filename)) {
+                if (progress) {
+                    progress(1000, progress_data);
+                }
+                return true;
+            }
+            LOG_WARN(LOG_CAT_DICT, "dictionary_load: Falling back to %s.", text_filename);
+        }
+    }
+    return dictionary_load_text_internal(dict, text_filename, progress, progress_data);
+}
+
+bool dictionary_load(Dictionary* dict, const char* binary_filename, const char* text_filename) {
+    return dictionary_load_with_progress(dict, binary_filename, text_filename, NULL, NULL);
+}
+
+void dictionary_free(Dictionary* dict) {
+    if (dict == NULL) {
+        return;
+    }
+    if (dict->mapping) {
+        // toate tabelele sunt in fisierul mapat, nimic alocat separat
+        dictionary_unmap_file(dict->mapping, dict->mapping_size);
+    } else {
+        free(dict->arena);
+        free(dict->offsets);
+        free(dict->lengths);
+        free(dict->letter_masks);
+        word_index_free(&dict->index);
+    }
+    free(dict->difficulty);
+    difficulty_index_free(&dict->difficulty_index);
+    memset(dict, 0, sizeof(Dictionary));
+}
+
+// --- Scorurile de dificultate (.scores) ---
+// Fisierul e mic (un octet pe cuvant), asa ca e citit cu fread; indexul pe (nivel, lungime) se face la incarcare.
+
+uint32_t dictionary_words_checksum(const Dictionary* dict) {
+    uint32_t hash = 2166136261u; // FNV-1a, ca dictionary_checksum
+    for (int i = 0; i < dict->word_count; i++) {
+        const unsigned char* word = (const unsigned char*)dictionary_word(dict, i);
+        for (int k = 0; k <= dict->lengths[i]; k++) {
+            hash ^= word[k]; // include '\0', ca "AB"+"C" sa difere de "A"+"BC"
+            hash *= 16777619u;
+        }
+    }
+    return hash;
+}
+
+bool dictionary_load_difficulty(Dictionary* dict, const char* filename) {
+    if (dict == NULL || filename == NULL || dict->word_count == 0) {
+        LOG_ERROR(LOG_CAT_DICT, "dictionary_load_difficulty: No dictionary or filename.");
+        return false;
+    }
+    FILE* file = fopen(filename, "rb");
+    if (!file) {
+        LOG_INFO(LOG_CAT_DICT, "dictionary_load_difficulty: No %s, words are picked by length only.", filename);
+        return false;
+    }
+    DifficultyFileHeader header;
+    unsigned char* scores = (unsigned char*)malloc((size_t)dict->word_count);
+    bool ok = scores != NULL &&
+              fread(&header, sizeof(header), 1, file) == 1 &&
+              memcmp(header.magic, DIFFICULTY_FILE_MAGIC, sizeof(header.magic)) == 0 &&
+              header.version == DIFFICULTY_FILE_VERSION &&
+              header.header_size == sizeof(DifficultyFileHeader) &&
+              header.word_count == (uint32_t)dict->word_count &&
+              fread(scores, 1, (size_t)dict->word_count, file) == (size_t)dict->word_count;
+    fclose(file);
+    // word_count e deja verificat; checksum-ul prinde o lista cu acelasi numar de cuvinte dar modificata
+    if (ok && header.words_checksum != dict->words_checksum) {
+        LOG_WARN(LOG_CAT_DICT, "dictionary_load_difficulty: %s was computed for another word list, ignoring it.", filename);
+        free(scores);
+        return false;
+    }
+    if (!ok) {
+        LOG_ERROR(LOG_CAT_DICT, "dictionary_load_difficulty: %s is not a valid version %d score file.", filename, DIFFICULTY_FILE_VERSION);
+        free(scores);
+        return false;
+    }
+    if (!difficulty_index_build(&dict->difficulty_index, dict->lengths, scores, dict->word_count)) {
+        free(scores);
+        return false;
+    }
+    free(dict->difficulty);
+    dict->difficulty = scores;
+    return true;
+}
+
+bool dictionary_write_difficulty(const Dictionary* dict, const unsigned char* scores, const char* filename) {
+    if (dict == NULL || scores == NULL || filename == NULL || dict->word_count == 0) {
+        LOG_ERROR(LOG_CAT_DICT, "dictionary_write_difficulty: Nothing to write.");
+        return false;
+    }
+    DifficultyFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, DIFFICULTY_FILE_MAGIC, sizeof(header.magic));
+    header.version = DIFFICULTY_FILE_VERSION;
+    header.header_size = sizeof(DifficultyFileHeader);
+    header.word_count = (uint32_t)dict->word_count;
+    header.words_checksum = dict->words_checksum;
+
+    FILE* file = fopen(filename, "wb");
+    if (!file) {
+        LOG_ERROR(LOG_CAT_DICT, "dictionary_write_difficulty: Cannot create %s: %s", filename, strerror(errno));
+        return false;
+    }
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+              fwrite(scores, 1, (size_t)dict->word_count, file) == (size_t)dict->word_count;
+    ok = (fclose(file) == 0) && ok;
+    if (!ok) {
+        LOG_ERROR(LOG_CAT_DICT, "dictionary_write_difficulty: Failed to write %s.", filename);
+    }
+    return ok;
+}
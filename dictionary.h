@@ -0,0 +1,93 @@
+#ifndef __DICTIONARY__
+#define __DICTIONARY__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "word_index.h"
+#include "difficulty_index.h"
+
+#define DICTIONARY_FILE_MAGIC "HGMDICT"   // 8 octeti cu '\0'
+#define DICTIONARY_FILE_VERSION 2   // 2: words_checksum in header
+#define DIFFICULTY_FILE_MAGIC "HGMSCOR"   // 8 octeti cu '\0'
+#define DIFFICULTY_FILE_VERSION 1
+
+// Lista de cuvinte tinuta intr-o singura zona de memorie (arena):
+// cuvantul i incepe la arena + offsets[i] si e terminat cu '\0'.
+// Toate cuvintele sunt cu litere mari A-Z si au cel mult WORD_INDEX_MAX_LENGTH litere.
+// letter_masks[i] are bitul k setat daca litera 'A' + k apare in cuvantul i.
+// Cand vine dintr-un fisier .bin, toate tabelele pointeaza direct in fisierul mapat (read-only).
+typedef struct Dictionary {
+    char* arena;
+    size_t arena_size;
+    unsigned int* offsets;
+    unsigned char* lengths;
+    unsigned int* letter_masks;
+    int word_count;
+    WordIndex index;
+    const unsigned char* mapping; // != NULL pentru dictionarele incarcate din .bin
+    size_t mapping_size;
+    unsigned char* difficulty;    // scorul 0..255 al fiecarui cuvant, din fisierul .scores; NULL daca lipseste
+    DifficultyIndex difficulty_index;
+    uint32_t words_checksum;      // dictionary_words_checksum, calculat la incarcarea .txt sau citit din headerul .bin
+} Dictionary;
+
+// Headerul fisierului .bin produs de tools/dict_compile.c; offset-urile sunt de la inceputul fisierului.
+typedef struct DictionaryFileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t header_size;
+    uint32_t word_count;
+    uint32_t max_word_length;
+    uint64_t arena_offset;
+    uint64_t arena_size;
+    uint64_t offsets_offset;   // uint32_t[word_count]
+    uint64_t lengths_offset;   // uint8_t[word_count]
+    uint64_t masks_offset;     // uint32_t[word_count]
+    uint64_t order_offset;     // int32_t[word_count], WordIndex.order
+    int32_t bucket_start[WORD_INDEX_MAX_LENGTH + 2];
+    uint32_t checksum;         // FNV-1a peste tot ce e dupa header
+    uint32_t words_checksum;   // dictionary_words_checksum, ca .scores/.book sa fie verificate fara sa citeasca arena
+} DictionaryFileHeader;
+
+// Fisierul .scores produs de tools/difficulty.c, pus langa dictionar: headerul urmat de
+// uint8_t scores[word_count], in ordinea cuvintelor din dictionar. words_checksum leaga scorurile de
+// exact lista de cuvinte pentru care au fost calculate (acelasi pentru .txt si .bin-ul compilat din el).
+typedef struct DifficultyFileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t header_size;
+    uint32_t word_count;
+    uint32_t words_checksum;   // dictionary_words_checksum
+} DifficultyFileHeader;
+
+// permille = 0..1000; apelat de pe firul care face incarcarea
+typedef void (*DictionaryProgressCallback)(int permille, void* user_data);
+
+bool dictionary_load_text(Dictionary* dict, const char* filename);
+bool dictionary_load_binary(Dictionary* dict, const char* filename);
+bool dictionary_load(Dictionary* dict, const char* binary_filename, const char* text_filename);
+bool dictionary_load_with_progress(Dictionary* dict, const char* binary_filename, const char* text_filename,
+                                   DictionaryProgressCallback progress, void* progress_data);
+bool dictionary_write_binary(const Dictionary* dict, const char* filename);
+void dictionary_free(Dictionary* dict);
+// scorurile de dificultate sunt optionale: fara fisier (sau cu unul vechi) selectia ramane doar pe lungime
+bool dictionary_load_difficulty(Dictionary* dict, const char* filename);
+bool dictionary_write_difficulty(const Dictionary* dict, const unsigned char* scores, const char* filename);
+
+unsigned int dictionary_letter_mask(const char* word, size_t length);
+uint32_t dictionary_checksum(const unsigned char* data, size_t size);
+uint32_t dictionary_words_checksum(const Dictionary* dict);   // FNV-1a peste cuvinte, fiecare cu '\0'; O(n), vezi dict->words_checksum
+
+// verificarea completa a unui .bin (lungimi, offset-uri, terminatori, WordIndex.order); O(n)
+bool dictionary_verify_tables(const Dictionary* dict);
+
+// tabelele unui .bin nu sunt verificate cuvant cu cuvant la incarcare: un indice sau offset in afara lor da ""
+static inline const char* dictionary_word(const Dictionary* dict, int i) {
+    if ((unsigned int)i >= (unsigned int)dict->word_count || dict->offsets[i] >= dict->arena_size) {
+        return "";
+    }
+    return dict->arena + dict->offsets[i];
+}
+
+#endif // __DICTIONARY__
@@ -0,0 +1,226 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "dictionary_cache.h"
+#include "log.h"
+
+typedef struct DictionaryCacheEntry {
+    Dictionary dictionary;  // scris doar de firul de incarcare pana la READY/FAILED
+    SDL_atomic_t state;     // DictionaryCacheState
+    SDL_atomic_t progress;  // 0..1000
+    SDL_Thread* loader;     // != NULL cat timp firul nu a fost asteptat (SDL_WaitThread)
+    GameLanguage language;
+    int refcount;   // cate moduri/jucatori folosesc acum dictionarul
+    PatternIndex patterns;  // pentru hint-uri; bucket-urile se construiesc la primul hint pe lungimea lor
+    bool patterns_ready;
+    OpeningBook book;       // citita la prima cerere (primul mod cu hint-uri sau bot), nu la incarcarea dictionarului
+    bool book_tried;        // o singura incercare, si cand fisierul lipseste
+} DictionaryCacheEntry;
+
+static DictionaryCacheEntry cache_entries[LANG_COUNT];
+
+const char* dictionary_cache_filename(GameLanguage lang) {
+    if (lang == LANG_ROMANIAN) {
+        return "words_ro.txt";
+    }
+    return "words_en.txt";
+}
+
+// varianta compilata cu tools/dict_compile; daca exista, e mapata direct fara parsare
+const char* dictionary_cache_binary_filename(GameLanguage lang) {
+    if (lang == LANG_ROMANIAN) {
+        return "words_ro.bin";
+    }
+    return "words_en.bin";
+}
+
+// scorurile de dificultate produse de tools/difficulty.c
+const char* dictionary_cache_difficulty_filename(GameLanguage lang) {
+    if (lang == LANG_ROMANIAN) {
+        return "words_ro.scores";
+    }
+    return "words_en.scores";
+}
+
+const char* dictionary_cache_book_filename(GameLanguage lang) {
+    if (lang == LANG_ROMANIAN) {
+        return "words_ro.book";
+    }
+    return "words_en.book";
+}
+
+static void dictionary_cache_report_progress(int permille, void* user_data) {
+    DictionaryCacheEntry* entry = (DictionaryCacheEntry*)user_data;
+    SDL_AtomicSet(&entry->progress, permille);
+}
+
+static bool dictionary_cache_load_entry(DictionaryCacheEntry* entry) {
+    const char* filename = dictionary_cache_filename(entry->language);
+    LOG_INFO(LOG_CAT_DICT, "Loading words from: %s for language %d.", filename, entry->language);
+    if (!dictionary_load_with_progress(&entry->dictionary, dictionary_cache_binary_filename(entry->language), filename,
+                                       dictionary_cache_report_progress, entry)) {
+        LOG_ERROR(LOG_CAT_DICT, "dictionary_cache: Failed to load %s.", filename);
+        return false;
+    }
+    // optional: fara scoruri hard/normal aleg doar dupa lungime
+    dictionary_load_difficulty(&entry->dictionary, dictionary_cache_difficulty_filename(entry->language));
+    return true;
+}
+
+static int dictionary_cache_loader_thread(void* data) {
+    DictionaryCacheEntry* entry = (DictionaryCacheEntry*)data;
+    bool ok = dictionary_cache_load_entry(entry);
+    // ultimul lucru facut de fir: dupa asta firul principal poate citi dictionarul
+    SDL_AtomicSet(&entry->state, ok ? DICTIONARY_CACHE_READY : DICTIONARY_CACHE_FAILED);
+    return ok ? 0 : 1;
+}
+
+// Preia rezultatul unui fir terminat (sau il asteapta, daca wait e true).
+static void dictionary_cache_join(DictionaryCacheEntry* entry, bool wait) {
+    if (entry->loader == NULL) {
+        return;
+    }
+    if (!wait && SDL_AtomicGet(&entry->state) == DICTIONARY_CACHE_LOADING) {
+        return;
+    }
+    SDL_WaitThread(entry->loader, NULL);
+    entry->loader = NULL;
+}
+
+bool dictionary_cache_prefetch(GameLanguage lang) {
+    if (lang < 0 || lang >= LANG_COUNT) {
+        LOG_ERROR(LOG_CAT_DICT, "dictionary_cache_prefetch: Invalid language %d.", lang);
+        return false;
+    }
+    DictionaryCacheEntry* entry = &cache_entries[lang];
+    dictionary_cache_join(entry, false);
+    int state = SDL_AtomicGet(&entry->state);
+    if (state == DICTIONARY_CACHE_LOADING || state == DICTIONARY_CACHE_READY) {
+        return true;
+    }
+
+    // NOT_LOADED sau FAILED (fisierul poate sa fi aparut intre timp)
+    entry->language = lang;
+    SDL_AtomicSet(&entry->progress, 0);
+    SDL_AtomicSet(&entry->state, DICTIONARY_CACHE_LOADING);
+    entry->loader = SDL_CreateThread(dictionary_cache_loader_thread, "dictionary_loader", entry);
+    if (entry->loader == NULL) {
+        LOG_WARN(LOG_CAT_DICT, "dictionary_cache_prefetch: Cannot start loader thread: %s", SDL_GetError());
+        SDL_AtomicSet(&entry->state, DICTIONARY_CACHE_NOT_LOADED); // se va incarca sincron la acquire
+        return false;
+    }
+    return true;
+}
+
+void dictionary_cache_poll(void) {
+    for (int i = 0; i < LANG_COUNT; i++) {
+        dictionary_cache_join(&cache_entries[i], false);
+    }
+}
+
+DictionaryCacheState dictionary_cache_state(GameLanguage lang, int* progress_permille) {
+    if (lang < 0 || lang >= LANG_COUNT) {
+        return DICTIONARY_CACHE_FAILED;
+    }
+    DictionaryCacheEntry* entry = &cache_entries[lang];
+    if (progress_permille) {
+        *progress_permille = SDL_AtomicGet(&entry->progress);
+    }
+    return (DictionaryCacheState)SDL_AtomicGet(&entry->state);
+}
+
+const Dictionary* dictionary_cache_acquire(GameLanguage lang) {
+    if (lang < 0 || lang >= LANG_COUNT) {
+        LOG_ERROR(LOG_CAT_DICT, "dictionary_cache_acquire: Invalid language %d.", lang);
+        return NULL;
+    }
+    DictionaryCacheEntry* entry = &cache_entries[lang];
+    dictionary_cache_join(entry, true); // blocheaza doar daca incarcarea e inca in curs
+
+    if (SDL_AtomicGet(&entry->state) != DICTIONARY_CACHE_READY) {
+        // nu s-a facut prefetch sau a esuat: incercare sincrona, ca inainte
+        entry->language = lang;
+        if (!dictionary_cache_load_entry(entry)) {
+            SDL_AtomicSet(&entry->state, DICTIONARY_CACHE_FAILED);
+            return NULL;
+        }
+        SDL_AtomicSet(&entry->state, DICTIONARY_CACHE_READY);
+    }
+    entry->refcount++;
+    return &entry->dictionary;
+}
+
+void dictionary_cache_release(const Dictionary* dict) {
+    if (dict == NULL) {
+        return;
+    }
+    for (int i = 0; i < LANG_COUNT; i++) {
+        DictionaryCacheEntry* entry = &cache_entries[i];
+        if (&entry->dictionary != dict) {
+            continue;
+        }
+        if (entry->refcount <= 0) {
+            LOG_WARN(LOG_CAT_DICT, "dictionary_cache_release: Language %d released more times than acquired.", i);
+            return;
+        }
+        entry->refcount--;
+        return;
+    }
+    LOG_WARN(LOG_CAT_DICT, "dictionary_cache_release: Dictionary %p is not owned by the cache.", (const void*)dict);
+}
+
+PatternIndex* dictionary_cache_patterns(const Dictionary* dict) {
+    if (dict == NULL) {
+        return NULL;
+    }
+    for (int i = 0; i < LANG_COUNT; i++) {
+        DictionaryCacheEntry* entry = &cache_entries[i];
+        if (&entry->dictionary != dict) {
+            continue;
+        }
+        if (!entry->patterns_ready) {
+            pattern_index_init(&entry->patterns, &entry->dictionary);
+            entry->patterns_ready = true;
+        }
+        return &entry->patterns;
+    }
+    LOG_WARN(LOG_CAT_DICT, "dictionary_cache_patterns: Dictionary %p is not owned by the cache.", (const void*)dict);
+    return NULL;
+}
+
+const OpeningBook* dictionary_cache_book(const Dictionary* dict) {
+    if (dict == NULL) {
+        return NULL;
+    }
+    for (int i = 0; i < LANG_COUNT; i++) {
+        DictionaryCacheEntry* entry = &cache_entries[i];
+        if (&entry->dictionary != dict) {
+            continue;
+        }
+        if (!entry->book_tried) {
+            entry->book_tried = true;
+            opening_book_load(&entry->book, &entry->dictionary, dictionary_cache_book_filename(entry->language));
+        }
+        return entry->book.nodes ? &entry->book : NULL;
+    }
+    LOG_WARN(LOG_CAT_DICT, "dictionary_cache_book: Dictionary %p is not owned by the cache.", (const void*)dict);
+    return NULL;
+}
+
+void dictionary_cache_shutdown(void) {
+    for (int i = 0; i < LANG_COUNT; i++) {
+        DictionaryCacheEntry* entry = &cache_entries[i];
+        dictionary_cache_join(entry, true);
+        if (entry->refcount > 0) {
+            LOG_WARN(LOG_CAT_DICT, "dictionary_cache_shutdown: Language %d still has %d borrowers.", i, entry->refcount);
+        }
+        if (entry->patterns_ready) {
+            pattern_index_free(&entry->patterns);
+        }
+        opening_book_free(&entry->book);
+        if (SDL_AtomicGet(&entry->state) == DICTIONARY_CACHE_READY) {
+            dictionary_free(&entry->dictionary);
+        }
+        memset(entry, 0, sizeof(DictionaryCacheEntry));
+    }
+}
@@ -0,0 +1,37 @@
+#ifndef __DICTIONARY_CACHE__
+#define __DICTIONARY_CACHE__
+
+#include <stdbool.h>
+#include "interface.h"   // For GameLanguage
+#include "dictionary.h"
+#include "pattern_index.h"
+#include "opening_book.h"
+
+typedef enum {
+    DICTIONARY_CACHE_NOT_LOADED,
+    DICTIONARY_CACHE_LOADING,
+    DICTIONARY_CACHE_READY,
+    DICTIONARY_CACHE_FAILED
+} DictionaryCacheState;
+
+// Cache la nivel de proces: fiecare limba e citita de pe disc cel mult o data.
+// Modurile de joc imprumuta un pointer read-only prin acquire si il dau inapoi prin release;
+// dictionarul ramane in cache si dupa ultimul release, ca schimbarea limbii sa nu recitesca fisierul.
+// prefetch porneste incarcarea pe un fir separat; acquire asteapta doar daca firul nu a terminat.
+// Toate functiile se apeleaza de pe firul principal.
+bool dictionary_cache_prefetch(GameLanguage lang);
+void dictionary_cache_poll(void);
+DictionaryCacheState dictionary_cache_state(GameLanguage lang, int* progress_permille);
+const Dictionary* dictionary_cache_acquire(GameLanguage lang);
+void dictionary_cache_release(const Dictionary* dict);
+// indexul pe pattern-uri al unui dictionar din cache, creat la prima cerere, eliberat la shutdown
+PatternIndex* dictionary_cache_patterns(const Dictionary* dict);
+// cartea de deschideri (tools/opening_book.c), citita la prima cerere; NULL daca nu exista fisierul
+const OpeningBook* dictionary_cache_book(const Dictionary* dict);
+const char* dictionary_cache_filename(GameLanguage lang);
+const char* dictionary_cache_binary_filename(GameLanguage lang);
+const char* dictionary_cache_difficulty_filename(GameLanguage lang);
+const char* dictionary_cache_book_filename(GameLanguage lang);
+void dictionary_cache_shutdown(void);
+
+#endif // __DICTIONARY_CACHE__
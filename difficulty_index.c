@@ -0,0 +1,96 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "difficulty_index.h"
+#include "log.h"
+
+bool difficulty_index_build(DifficultyIndex* index, const unsigned char* lengths, const unsigned char* scores, int word_count) {
+    if (index == NULL) {
+        LOG_ERROR(LOG_CAT_DICT, "difficulty_index_build: DifficultyIndex pointer is NULL.");
+        return false;
+    }
+    memset(index, 0, sizeof(DifficultyIndex));
+    if (lengths == NULL || scores == NULL || word_count <= 0) {
+        return true; // index gol, selectia ramane pe WordIndex
+    }
+
+    index->order = (int*)malloc(word_count * sizeof(int));
+    if (!index->order) {
+        LOG_ERROR(LOG_CAT_DICT, "difficulty_index_build: Failed to allocate index for %d words.", word_count);
+        return false;
+    }
+
+    // counting sort dupa (nivel, lungime), ca in word_index_build
+    int counts[DIFFICULTY_LEVELS][WORD_INDEX_MAX_LENGTH + 2] = {{0}};
+    for (int i = 0; i < word_count; i++) {
+        if (lengths[i] >= 1 && lengths[i] <= WORD_INDEX_MAX_LENGTH) {
+            counts[difficulty_level_of_score(scores[i])][lengths[i]]++;
+        }
+    }
+
+    int offset = 0;
+    for (int level = 0; level < DIFFICULTY_LEVELS; level++) {
+        for (int len = 1; len <= WORD_INDEX_MAX_LENGTH; len++) {
+            index->level_start[level][len] = offset;
+            offset += counts[level][len];
+        }
+        index->level_start[level][WORD_INDEX_MAX_LENGTH + 1] = offset;
+    }
+
+    int fill[DIFFICULTY_LEVELS][WORD_INDEX_MAX_LENGTH + 2];
+    memcpy(fill, index->level_start, sizeof(fill));
+    for (int i = 0; i < word_count; i++) {
+        if (lengths[i] >= 1 && lengths[i] <= WORD_INDEX_MAX_LENGTH) {
+            index->order[fill[difficulty_level_of_score(scores[i])][lengths[i]]++] = i;
+        }
+    }
+    return true;
+}
+
+void difficulty_index_free(DifficultyIndex* index) {
+    if (index == NULL) {
+        return;
+    }
+    free(index->order);
+    memset(index, 0, sizeof(DifficultyIndex));
+}
+
+bool difficulty_index_ready(const DifficultyIndex* index) {
+    return index != NULL && index->order != NULL;
+}
+
+int difficulty_index_count(const DifficultyIndex* index, int level, int min_length, int max_length) {
+    if (min_length < 1) {
+        min_length = 1;
+    }
+    if (max_length > WORD_INDEX_MAX_LENGTH) {
+        max_length = WORD_INDEX_MAX_LENGTH;
+    }
+    if (!difficulty_index_ready(index) || level < 0 || level >= DIFFICULTY_LEVELS || min_length > max_length) {
+        return 0;
+    }
+    return index->level_start[level][max_length + 1] - index->level_start[level][min_length];
+}
+
+int difficulty_index_pick(const DifficultyIndex* index, int level, int min_length, int max_length, unsigned int random_value) {
+    if (level < 0) {
+        level = 0;
+    } else if (level >= DIFFICULTY_LEVELS) {
+        level = DIFFICULTY_LEVELS - 1;
+    }
+    if (min_length < 1) {
+        min_length = 1;
+    }
+    // cel mult 2 * DIFFICULTY_LEVELS incercari, indiferent de marimea dictionarului
+    for (int distance = 0; distance < DIFFICULTY_LEVELS; distance++) {
+        int tries[2] = {level - distance, level + distance};
+        for (int t = 0; t < (distance ? 2 : 1); t++) {
+            int count = difficulty_index_count(index, tries[t], min_length, max_length);
+            if (count > 0) {
+                return index->order[index->level_start[tries[t]][min_length] + (int)(random_value % (unsigned int)count)];
+            }
+        }
+    }
+    return -1;
+}
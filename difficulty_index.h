@@ -0,0 +1,32 @@
+#ifndef __DIFFICULTY_INDEX__
+#define __DIFFICULTY_INDEX__
+
+#include <stdbool.h>
+#include "word_index.h"
+
+#define DIFFICULTY_LEVELS 8   // scorurile 0..255 impartite in atatea niveluri egale (scorul e percentila)
+
+// Index pe dificultate, construit la incarcarea scorurilor (tools/difficulty.c): cuvintele sunt sortate
+// dupa (nivel, lungime), asa ca pentru un nivel orice interval de lungimi e o bucata continua din order:
+// order[level_start[nivel][min] .. level_start[nivel][max + 1]). Alegerea e deci O(1) si pentru
+// "orice lungime" (normal) si pentru INITIAL_WORD_LENGTH..MAX_GAME_WORD_LENGTH (hard).
+typedef struct DifficultyIndex {
+    int* order;
+    int level_start[DIFFICULTY_LEVELS][WORD_INDEX_MAX_LENGTH + 2];   // indexat cu lungimea 1..MAX + 1
+} DifficultyIndex;
+
+static inline int difficulty_level_of_score(unsigned int score) {
+    return (int)(score * DIFFICULTY_LEVELS / 256);
+}
+
+// scores[i] = 0..255 pentru cuvantul i; cuvintele cu lungime 0 sau prea mari nu intra in index
+bool difficulty_index_build(DifficultyIndex* index, const unsigned char* lengths, const unsigned char* scores, int word_count);
+void difficulty_index_free(DifficultyIndex* index);
+bool difficulty_index_ready(const DifficultyIndex* index);
+
+int difficulty_index_count(const DifficultyIndex* index, int level, int min_length, int max_length);
+// un cuvant aleator de nivelul dat, cu lungimea in [min_length, max_length]; daca nivelul nu are
+// asemenea cuvinte, din cel mai apropiat nivel care are (mai intai cel mai usor). -1 daca nu exista deloc.
+int difficulty_index_pick(const DifficultyIndex* index, int level, int min_length, int max_length, unsigned int random_value);
+
+#endif // __DIFFICULTY_INDEX__
@@ -0,0 +1,240 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "evil.h"
+#include "log.h"
+
+typedef struct EvilPartitionJob {
+    EvilGame* evil;
+    int letter;
+} EvilPartitionJob;
+
+bool evil_init(EvilGame* evil, PatternIndex* patterns, ParallelPool* pool) {
+    if (evil == NULL) {
+        return false;
+    }
+    memset(evil, 0, sizeof(EvilGame));
+    evil->patterns = patterns;
+    evil->pool = pool;
+    evil->family_tables = parallel_pool_size(pool);
+    evil->families = (EvilFamilies*)calloc((size_t)evil->family_tables, sizeof(EvilFamilies));
+    if (!evil->families) {
+        LOG_ERROR(LOG_CAT_RULES, "evil_init: Failed to allocate %d family tables.", evil->family_tables);
+        return false;
+    }
+    return true;
+}
+
+void evil_free(EvilGame* evil) {
+    if (evil == NULL) {
+        return;
+    }
+    for (int i = 0; i < evil->family_tables && evil->families; i++) {
+        free(evil->families[i].masks);
+        free(evil->families[i].counts);
+    }
+    free(evil->families);
+    free(evil->candidates);
+    memset(evil, 0, sizeof(EvilGame));
+}
+
+bool evil_reset(EvilGame* evil, HangmanGame* hangman, const RulesEnv* env) {
+    if (evil == NULL || hangman == NULL || hangman->dictionary == NULL || evil->patterns == NULL) {
+        LOG_ERROR(LOG_CAT_RULES, "evil_reset: No word list.");
+        return false;
+    }
+    const WordIndex* index = &hangman->dictionary->index;
+    int length = word_index_random_length(index, EVIL_MIN_WORD_LENGTH, EVIL_MAX_WORD_LENGTH, env->rand(env->rand_data));
+    if (length < 0) {
+        length = word_index_random_length(index, 1, MAX_WORD_LENGTH, env->rand(env->rand_data));
+    }
+    evil->bucket = pattern_index_bucket(evil->patterns, length);
+    if (evil->bucket == NULL) {
+        rules_evil_reset(hangman, NULL);
+        return false;
+    }
+    if (evil->capacity_blocks < evil->bucket->block_count) {
+        uint64_t* candidates = (uint64_t*)realloc(evil->candidates, (size_t)evil->bucket->block_count * sizeof(uint64_t));
+        if (!candidates) {
+            LOG_ERROR(LOG_CAT_RULES, "evil_reset: Failed to allocate %d candidate blocks.", evil->bucket->block_count);
+            evil->bucket = NULL;
+            rules_evil_reset(hangman, NULL);
+            return false;
+        }
+        evil->candidates = candidates;
+        evil->capacity_blocks = evil->bucket->block_count;
+    }
+
+    // niciun caracter descoperit: toate cuvintele lungimii
+    char pattern[MAX_WORD_LENGTH + 1];
+    memset(pattern, '_', (size_t)length);
+    pattern[length] = '\0';
+    evil->candidate_count = pattern_bucket_query(evil->bucket, pattern, 0, evil->candidates);
+    evil->unknown_positions = (1u << length) - 1;
+    LOG_DEBUG(LOG_CAT_RULES, "evil_reset: length %d, %d candidates.", length, evil->candidate_count);
+    return rules_evil_reset(hangman, rules_pick_word(hangman->dictionary, length, env));
+}
+
+// tabelele au acelasi numar de sloturi; se golesc dupa fiecare litera
+static bool evil_reserve_families(EvilGame* evil, int capacity) {
+    for (int i = 0; i < evil->family_tables; i++) {
+        EvilFamilies* families = &evil->families[i];
+        if (families->capacity >= capacity) {
+            continue;
+        }
+        free(families->masks);
+        free(families->counts);
+        families->masks = (uint32_t*)calloc((size_t)capacity, sizeof(uint32_t));
+        families->counts = (int*)calloc((size_t)capacity, sizeof(int));
+        if (!families->masks || !families->counts) {
+            LOG_ERROR(LOG_CAT_RULES, "evil_reserve_families: Failed to allocate %d families.", capacity);
+            free(families->masks);
+            free(families->counts);
+            families->masks = NULL;
+            families->counts = NULL;
+            families->capacity = 0;
+            return false;
+        }
+        families->capacity = capacity;
+    }
+    return true;
+}
+
+static void evil_families_add(EvilFamilies* families, uint32_t mask, int count) {
+    uint32_t slot_mask = (uint32_t)families->capacity - 1;
+    uint32_t slot = ((mask * 0x9E3779B1u) >> 8) & slot_mask;
+    while (families->masks[slot] != 0 && families->masks[slot] != mask) {
+        slot = (slot + 1) & slot_mask;
+    }
+    families->masks[slot] = mask;
+    families->counts[slot] += count;
+}
+
+// bit p = word[p] == letter, 8 litere odata (SWAR: octetii egali devin 0, apoi bitul lor inalt e adunat intr-un octet)
+static inline uint32_t evil_letter_positions(const char* word, int length, uint64_t broadcast) {
+    uint32_t mask = 0;
+    for (int p = 0; p < length; p += 8) {
+        uint64_t chunk;
+        memcpy(&chunk, word + p, sizeof(chunk));
+        uint64_t x = chunk ^ broadcast;
+        uint64_t zero = ~(((x & 0x7F7F7F7F7F7F7F7Full) + 0x7F7F7F7F7F7F7F7Full) | x) & 0x8080808080808080ull;
+        mask |= (uint32_t)(((zero >> 7) * 0x0102040810204080ull) >> 56) << p;
+    }
+    return mask & ((1u << length) - 1); // octetii de dupa cuvant sunt din urmatorul (sau padding)
+}
+
+// un chunk de blocuri din bitsetul candidatilor, in tabela firului
+static void evil_partition_blocks(void* context, int begin, int end, int worker) {
+    const EvilPartitionJob* job = (const EvilPartitionJob*)context;
+    const EvilGame* evil = job->evil;
+    const PatternBucket* bucket = evil->bucket;
+    const uint64_t* present = pattern_bucket_letter_bits(bucket, job->letter);
+    EvilFamilies* families = &evil->families[worker];
+    uint64_t broadcast = 0x0101010101010101ull * (uint64_t)('A' + job->letter);
+    int length = bucket->length;
+
+    for (int block = begin; block < end; block++) {
+        uint64_t bits = evil->candidates[block] & present[block];
+        while (bits) {
+            int j = block * 64 + __builtin_ctzll(bits);
+            bits &= bits - 1;
+            // litera nu e descoperita, deci nu poate fi pe o pozitie deja afisata: ajunge o trecere simpla
+            evil_families_add(families, evil_letter_positions(pattern_bucket_word(bucket, j), length, broadcast), 1);
+        }
+    }
+}
+
+static bool evil_better_family(uint32_t mask, int count, uint32_t best_mask, int best_count) {
+    // cea mai mare; la egalitate cea cu mai putine litere descoperite (ratarea = masca 0 castiga)
+    if (count != best_count) {
+        return count > best_count;
+    }
+    int bits = __builtin_popcount(mask);
+    int best_bits = __builtin_popcount(best_mask);
+    if (bits != best_bits) {
+        return bits < best_bits;
+    }
+    return mask < best_mask;
+}
+
+// masca familiei pastrate (0 = ratare); tabelele firelor sunt unite in prima
+static uint32_t evil_pick_family(EvilGame* evil, int letter) {
+    int unknown_count = __builtin_popcount(evil->unknown_positions);
+    long possible = unknown_count >= 20 ? evil->candidate_count : (1L << unknown_count);
+    if (possible > evil->candidate_count) {
+        possible = evil->candidate_count;
+    }
+    int capacity = 16;
+    while (capacity < 2 * possible) {
+        capacity *= 2;
+    }
+    if (!evil_reserve_families(evil, capacity)) {
+        return 0;
+    }
+
+    EvilPartitionJob job = {evil, letter};
+    bool parallel = evil->candidate_count >= EVIL_PARALLEL_MIN_CANDIDATES;
+    parallel_for(parallel ? evil->pool : NULL, evil->bucket->block_count, EVIL_PARALLEL_GRAIN_BLOCKS,
+                 evil_partition_blocks, &job);
+
+    EvilFamilies* merged = &evil->families[0];
+    int tables = parallel ? parallel_pool_size(evil->pool) : 1;
+    for (int i = 1; i < tables; i++) {
+        EvilFamilies* families = &evil->families[i];
+        for (int slot = 0; slot < families->capacity; slot++) {
+            if (families->masks[slot] != 0) {
+                evil_families_add(merged, families->masks[slot], families->counts[slot]);
+                families->masks[slot] = 0;
+                families->counts[slot] = 0;
+            }
+        }
+    }
+
+    int hits = 0;
+    int family_count = 0;
+    uint32_t best_mask = 0;
+    int best_count = 0;
+    for (int slot = 0; slot < merged->capacity; slot++) {
+        if (merged->masks[slot] == 0) {
+            continue;
+        }
+        hits += merged->counts[slot];
+        family_count++;
+        if (evil_better_family(merged->masks[slot], merged->counts[slot], best_mask, best_count)) {
+            best_mask = merged->masks[slot];
+            best_count = merged->counts[slot];
+        }
+        merged->masks[slot] = 0;
+        merged->counts[slot] = 0;
+    }
+    int misses = evil->candidate_count - hits;
+    if (evil_better_family(0, misses, best_mask, best_count)) {
+        best_mask = 0;
+        best_count = misses;
+    }
+    LOG_DEBUG(LOG_CAT_RULES, "evil_pick_family: %c splits %d candidates into %d families + %d misses, keeping %d.",
+              'A' + letter, evil->candidate_count, family_count, misses, best_count);
+    return best_mask;
+}
+
+RulesGuessResult evil_guess(EvilGame* evil, HangmanGame* hangman, char letter) {
+    if (letter >= 'a' && letter <= 'z') {
+        letter = (char)(letter - 32);
+    }
+    if (evil == NULL || evil->bucket == NULL || hangman->game_over || letter < 'A' || letter > 'Z' ||
+        hangman->guessed_letters[letter - 'A'] || evil->candidate_count == 0) {
+        return rules_normal_guess(hangman, letter); // ignorata (sau runda fara candidati: cuvantul ramane cel afisat)
+    }
+    int index = letter - 'A';
+    uint32_t positions = evil_pick_family(evil, index);
+    evil->candidate_count = pattern_bucket_apply_guess(evil->bucket, evil->candidates, index,
+                                                       positions, evil->unknown_positions);
+    evil->unknown_positions &= ~positions;
+
+    int representative = pattern_bucket_next(evil->bucket, evil->candidates, 0);
+    if (representative >= 0) {
+        rules_evil_replace_word(hangman, dictionary_word(evil->patterns->dictionary, evil->bucket->words[representative]));
+    }
+    return rules_normal_guess(hangman, letter);
+}
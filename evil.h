@@ -0,0 +1,46 @@
+#ifndef __EVIL__
+#define __EVIL__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "rules.h"
+#include "pattern_index.h"
+#include "parallel.h"
+
+// "Evil hangman": jocul nu se hotaraste asupra unui cuvant. Tine toti candidatii compatibili cu ce s-a
+// afisat (bitset peste bucket-ul lungimii, ca hint.c) si, la fiecare litera, ii imparte in familii dupa
+// pozitiile pe care ar aparea litera (ratarea e si ea o familie); ramane cea mai mare familie.
+// Partitionarea e o trecere cu hash pe masca de pozitii peste candidatii care contin litera (bitsetul de
+// prezenta al literei, construit din letter_masks); pe bucket-urile mari ruleaza pe ParallelPool, cu cate
+// o tabela de familii pe fir, unite la sfarsit. HangmanGame.word e doar un reprezentant al familiei ramase.
+
+#define EVIL_MIN_WORD_LENGTH 4
+#define EVIL_MAX_WORD_LENGTH 9
+#define EVIL_PARALLEL_MIN_CANDIDATES 32768   // sub atat firul apelant e mai rapid decat trezirea pool-ului
+#define EVIL_PARALLEL_GRAIN_BLOCKS 64        // 4096 cuvinte pe chunk
+
+typedef struct EvilFamilies {
+    uint32_t* masks;   // pozitiile literei; 0 = slot liber (ratarea se numara separat)
+    int* counts;
+    int capacity;      // putere a lui 2, cel putin dublul familiilor posibile
+} EvilFamilies;
+
+typedef struct EvilGame {
+    PatternIndex* patterns;        // imprumutat (dictionary_cache)
+    ParallelPool* pool;            // imprumutat, poate fi NULL (totul pe firul apelant)
+    const PatternBucket* bucket;
+    uint64_t* candidates;
+    int capacity_blocks;
+    int candidate_count;
+    uint32_t unknown_positions;
+    EvilFamilies* families;        // una pe worker din pool
+    int family_tables;
+} EvilGame;
+
+bool evil_init(EvilGame* evil, PatternIndex* patterns, ParallelPool* pool);
+void evil_free(EvilGame* evil);
+// runda noua: lungime aleatoare din [EVIL_MIN_WORD_LENGTH, EVIL_MAX_WORD_LENGTH], toate cuvintele ei candidate
+bool evil_reset(EvilGame* evil, HangmanGame* hangman, const RulesEnv* env);
+RulesGuessResult evil_guess(EvilGame* evil, HangmanGame* hangman, char letter);
+
+#endif // __EVIL__
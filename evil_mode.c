@@ -0,0 +1,177 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <errno.h>
+#include "evil_mode.h"
+#include "interface.h"
+#include "dictionary_cache.h"
+#include "log.h"
+
+void evil_mode_process_key(Game* game, char key) {
+    if (game == NULL || game->hangman == NULL || game->evil_data == NULL) {
+        LOG_ERROR(LOG_CAT_EVIL, "error at evil_mode_process_key");
+        return;
+    }
+    if (game->hangman->game_over) {
+        evil_mode_reset(game);
+        return;
+    }
+    evil_guess(game->evil_data, game->hangman, key);
+}
+
+void evil_mode_reset(Game* game) {
+    if (game == NULL || game->hangman == NULL || game->evil_data == NULL) {
+        LOG_ERROR(LOG_CAT_EVIL, "error at evil mode reset");
+        return;
+    }
+    evil_reset(game->evil_data, game->hangman, &game->rules_env);
+}
+
+void evil_mode_init(Game* game) {
+    if (game == NULL) {
+        LOG_ERROR(LOG_CAT_EVIL, "evil_mode_init: Game pointer is NULL. Aborting initialization.");
+        return;
+    }
+    if (game->hangman != NULL) {
+        evil_mode_cleanup(game);
+    }
+
+    // firele se pornesc o singura data, la prima intrare in evil mode, si raman pana la iesirea din joc
+    if (game->workers == NULL) {
+        game->workers = parallel_pool_create(0);
+    }
+
+    game->hangman = calloc(1, sizeof(HangmanGame));
+    game->evil_data = malloc(sizeof(EvilGame));
+    if (!game->hangman || !game->evil_data) {
+        LOG_ERROR(LOG_CAT_EVIL, "evil_mode_init: Failed to allocate memory for evil mode: %s", strerror(errno));
+        free(game->hangman);
+        free(game->evil_data);
+        game->hangman = NULL;
+        game->evil_data = NULL;
+        return;
+    }
+
+    if (!normal_mode_load_words_from_file(game->hangman, game->current_language) ||
+        !evil_init(game->evil_data, dictionary_cache_patterns(game->hangman->dictionary), game->workers)) {
+        LOG_ERROR(LOG_CAT_EVIL, "evil_mode_init: Failed to load words from file.");
+        evil_mode_cleanup(game);
+        return;
+    }
+
+    evil_mode_reset(game);
+}
+
+void evil_mode_cleanup(Game* game) {
+    if (game == NULL) {
+        return;
+    }
+    if (game->evil_data) {
+        evil_free(game->evil_data);
+        free(game->evil_data);
+        game->evil_data = NULL;
+    }
+    if (game->hangman) {
+        normal_mode_release_words(game->hangman); // dictionarul (si indexul lui) raman in cache
+        free(game->hangman);
+        game->hangman = NULL;
+    }
+}
+
+void evil_mode_handle_event(Game* game, SDL_Event* event) {
+    if (game == NULL || game->hangman == NULL) {
+        LOG_ERROR(LOG_CAT_EVIL, "evil_mode_handle_event: game or game->hangman is NULL. Cannot handle event.");
+        return;
+    }
+    switch (event->type) {
+        case SDL_KEYDOWN: {
+            SDL_Keycode key = event->key.keysym.sym;
+            if (key >= SDLK_a && key <= SDLK_z) {
+                evil_mode_process_key(game, (char)key);
+            }
+            break;
+        }
+
+        case SDL_MOUSEBUTTONDOWN:
+            if (event->button.button == SDL_BUTTON_LEFT) {
+                if (game->hangman->game_over) {
+                    evil_mode_reset(game);
+                    break;
+                }
+                for (int i = 0; i < ALPHABET_SIZE; i++) {
+                    SDL_Rect rect = game->letter_rects[i];
+                    if (event->button.x >= rect.x && event->button.x <= rect.x + rect.w &&
+                        event->button.y >= rect.y && event->button.y <= rect.y + rect.h) {
+                        evil_mode_process_key(game, 'A' + i);
+                        break;
+                    }
+                }
+            }
+            break;
+    }
+}
+
+// ca in normal mode, tabla se schimba doar la o tasta/click
+static uint64_t evil_mode_board_key(const HangmanGame* hangman) {
+    uint64_t key = render_layer_key_int(RENDER_LAYER_KEY_INIT, EVIL_MODE);
+    key = render_layer_key_bytes(key, hangman->guessed_letters, sizeof(hangman->guessed_letters));
+    key = render_layer_key_int(key, hangman->wrong_guesses);
+    key = render_layer_key_int(key, hangman->game_over * 2 + hangman->win);
+    key = render_layer_key_string(key, hangman->word);
+    return render_layer_key_string(key, hangman->displayed_word);
+}
+
+static void evil_mode_render_board(Game* game) {
+    SDL_SetRenderDrawColor(game->renderer, 40, 10, 10, 255);
+    SDL_RenderClear(game->renderer);
+
+    SDL_Color white = {255, 255, 255, 255};
+    SDL_Color green = {0, 255, 0, 255};
+    SDL_Color red = {255, 0, 0, 255};
+    char text_buffer[100];
+
+    render_text(game->renderer, game->text_font, "EVIL MODE", red,
+                (WIDTH - (strlen("EVIL MODE") * FONT_SIZE / 2)) / 2, 50);
+
+    render_hangman_image(game->renderer, game->hangman->wrong_guesses, 0, 0, false);
+
+    render_text(game->renderer, game->text_font, game->hangman->displayed_word, white,
+                (WIDTH - (strlen(game->hangman->displayed_word) * FONT_SIZE / 2)) / 2 + 60, 500);
+
+    if (game->hangman->game_over) {
+        SDL_Color message_color = game->hangman->win ? green : red;
+        const char* message = game->hangman->win ? "YOU CORNERED IT!" : "GAME OVER!";
+        render_text(game->renderer, game->text_font, message, message_color,
+                    (WIDTH - (strlen(message) * FONT_SIZE / 2)) / 2, 150);
+
+        if (!game->hangman->win) {
+            // oricare dintre cuvintele ramase ar fi fost raspunsul; se arata reprezentantul
+            snprintf(text_buffer, sizeof(text_buffer), "The word was: %s", game->hangman->word);
+            render_text(game->renderer, game->text_font, text_buffer, white,
+                        (WIDTH - (strlen(text_buffer) * FONT_SIZE / 2)) / 2 + 40, 200);
+        }
+
+        render_text(game->renderer, game->text_font, "Press click to play again", white,
+                    (WIDTH - (strlen("Press click to play again") * FONT_SIZE / 2)) / 2 + 50, 700);
+    } else {
+        const SDL_Color key_colors[KEY_STATE_COUNT] = {{100, 100, 100, 255}, green, red};
+        for (int i = 0; i < ALPHABET_SIZE; i++) {
+            SDL_Color key_color = key_colors[keyboard_key_state(game->hangman, i)];
+            SDL_SetRenderDrawColor(game->renderer, key_color.r, key_color.g, key_color.b, key_color.a);
+            SDL_RenderFillRect(game->renderer, &game->letter_rects[i]);
+            render_letter_key(game, i, white);
+        }
+    }
+}
+
+void evil_mode_render(Game* game) {
+    if (game == NULL || game->hangman == NULL) {
+        LOG_ERROR(LOG_CAT_EVIL, "evil_mode_render: game or game->hangman is NULL. Cannot render evil mode.");
+        return;
+    }
+    if (render_layer_begin(&game->board_layer, game->renderer, evil_mode_board_key(game->hangman))) {
+        evil_mode_render_board(game);
+        render_layer_end(&game->board_layer, game->renderer);
+    }
+    render_layer_draw(&game->board_layer, game->renderer);
+}
@@ -0,0 +1,18 @@
+#ifndef __EVIL_MODE__
+#define __EVIL_MODE__
+
+#include <SDL2/SDL.h>
+#include <stdbool.h>
+#include "interface.h"   // For Game struct
+#include "normal_mode.h" // For the word loading shared by all modes
+#include "evil.h"        // EvilGame and the evil rules
+
+// Evil mode: same board as normal mode, but the word is only decided when it can no longer be avoided (evil.c)
+void evil_mode_init(Game* game);
+void evil_mode_cleanup(Game* game);
+void evil_mode_reset(Game* game);
+void evil_mode_handle_event(Game* game, SDL_Event* event);
+void evil_mode_render(Game* game);
+void evil_mode_process_key(Game* game, char key);
+
+#endif // __EVIL_MODE__
@@ -0,0 +1,51 @@
+#include <stdio.h>
+
+#include "frame_pacer.h"
+
+void frame_pacer_init(FramePacer* pacer, SDL_Window* window, SDL_Renderer* renderer) {
+    int refresh_rate = FRAME_PACER_DEFAULT_HZ;
+    SDL_DisplayMode mode;
+    int display = SDL_GetWindowDisplayIndex(window);
+    if (display >= 0 && SDL_GetCurrentDisplayMode(display, &mode) == 0 && mode.refresh_rate > 0) {
+        refresh_rate = mode.refresh_rate;
+    }
+
+    SDL_RendererInfo info;
+    pacer->vsync = (SDL_GetRendererInfo(renderer, &info) == 0) && (info.flags & SDL_RENDERER_PRESENTVSYNC);
+    pacer->frequency = SDL_GetPerformanceFrequency();
+    pacer->frame_ticks = pacer->frequency / (Uint64)refresh_rate;
+    pacer->deadline = 0;
+}
+
+void frame_pacer_end_frame(FramePacer* pacer) {
+    Uint64 now = SDL_GetPerformanceCounter();
+    if (pacer->deadline == 0) {
+        pacer->deadline = now;
+    }
+    pacer->deadline += pacer->frame_ticks;
+    if (now >= pacer->deadline) {
+        // frame mai lung decat bugetul: urmatorul incepe imediat, dar termenul nu ramane in urma cu mai mult de un frame
+        if (now - pacer->deadline > pacer->frame_ticks) {
+            pacer->deadline = now;
+        }
+        return;
+    }
+
+    Sint64 remaining_ms = (Sint64)((pacer->deadline - now) * 1000 / pacer->frequency);
+    if (pacer->vsync) {
+        remaining_ms -= FRAME_PACER_VSYNC_SLACK_MS;
+    }
+    if (remaining_ms > 0) {
+        SDL_Delay((Uint32)remaining_ms);
+    }
+}
+
+// true daca a venit un eveniment (ramane in coada pentru handle_events), false la timeout
+bool frame_pacer_wait_for_event(FramePacer* pacer, Uint32 timeout_ms) {
+    pacer->deadline = 0;
+    return SDL_WaitEventTimeout(NULL, (int)timeout_ms) == 1;
+}
+
+bool frame_pacer_window_visible(SDL_Window* window) {
+    return !(SDL_GetWindowFlags(window) & (SDL_WINDOW_MINIMIZED | SDL_WINDOW_HIDDEN));
+}
@@ -0,0 +1,26 @@
+#ifndef __FRAME_PACER__
+#define __FRAME_PACER__
+
+#include <SDL2/SDL.h>
+#include <stdbool.h>
+
+#define FRAME_PACER_DEFAULT_HZ 60      // daca display-ul nu isi spune frecventa
+#define FRAME_PACER_VSYNC_SLACK_MS 2   // cu vsync se doarme mai putin, ca SDL_RenderPresent sa prinda vblank-ul
+#define FRAME_PACER_IDLE_WAIT_MS 1000  // cand nimic nu se misca, bucla se trezeste doar la evenimente (sau atat)
+
+// Ritmul buclei principale: un frame la fiecare perioada de refresh a display-ului.
+// Timpul deja consumat de frame se scade din somn, iar un frame intarziat muta termenul in loc
+// sa fie recuperat in rafala. Cu vsync functional SDL_RenderPresent asteapta deja, deci somnul e ~0.
+typedef struct FramePacer {
+    Uint64 frequency;
+    Uint64 frame_ticks;   // perioada tinta, in unitati SDL_GetPerformanceCounter
+    Uint64 deadline;      // cand poate incepe frame-ul urmator; 0 = dupa idle, termenul se reia de la zero
+    bool vsync;
+} FramePacer;
+
+void frame_pacer_init(FramePacer* pacer, SDL_Window* window, SDL_Renderer* renderer);
+void frame_pacer_end_frame(FramePacer* pacer);
+bool frame_pacer_wait_for_event(FramePacer* pacer, Uint32 timeout_ms);
+bool frame_pacer_window_visible(SDL_Window* window);
+
+#endif // __FRAME_PACER__
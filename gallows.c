@@ -0,0 +1,272 @@
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "gallows.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#define GALLOWS_MAX_SEGMENTS (4 + GALLOWS_HEAD_SEGMENTS + 5)
+#define GALLOWS_MAX_POINTS 128      // 125 folosite
+#define GALLOWS_MAX_STROKE_WIDTH 16.0f
+
+typedef struct GallowsSegment {
+    float x1, y1, x2, y2;
+} GallowsSegment;
+
+// Tot desenul pentru o pozitie pe ecran, calculat o singura data.
+// Etapa k (k greseli) e un prefix al tabelelor: primele point_count[k] puncte / index_count[k] indici.
+typedef struct GallowsFigure {
+    int x_offset;
+    int y_offset;
+    bool mirrored;
+
+    // o singura linie franta: unele bucati sunt parcurse de doua ori ca sa ajunga la urmatoarea parte
+    SDL_Point points[GALLOWS_MAX_POINTS];
+    int point_count[GALLOWS_STAGE_COUNT];
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    // fiecare segment e un quad (si inca doua benzi transparente pentru AA)
+    SDL_Vertex vertices[GALLOWS_MAX_SEGMENTS * 8];
+    int indices[GALLOWS_MAX_SEGMENTS * 18];
+    int vertex_count;
+    int index_count[GALLOWS_STAGE_COUNT];
+#endif
+} GallowsFigure;
+
+static GallowsFigure figure_cache[GALLOWS_CACHE_SIZE];
+static int figure_cache_count = 0;
+static int figure_cache_next = 0;   // urmatoarea intrare inlocuita cand cache-ul e plin
+static float stroke_width = GALLOWS_STROKE_WIDTH;
+static bool stroke_antialiased = GALLOWS_STROKE_ANTIALIAS;
+
+static bool gallows_uses_geometry(void) {
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    return stroke_width > 1.0f || stroke_antialiased;
+#else
+    return false;
+#endif
+}
+
+static void gallows_add_point(GallowsFigure* figure, int* count, int x, int y) {
+    if (*count < GALLOWS_MAX_POINTS) {
+        figure->points[(*count)++] = (SDL_Point){x, y};
+    }
+}
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+static void gallows_add_stroke(GallowsFigure* figure, int* index_count, const GallowsSegment* segment) {
+    float dx = segment->x2 - segment->x1;
+    float dy = segment->y2 - segment->y1;
+    float length = sqrtf(dx * dx + dy * dy);
+    if (length <= 0.0f) {
+        return;
+    }
+    float half = stroke_width * 0.5f;
+    float ux = dx / length;             // directia segmentului
+    float uy = dy / length;
+    float nx = -uy;                     // normala
+    float ny = ux;
+    // capetele sunt prelungite cu jumatate de grosime, ca imbinarile din cerc sa nu aiba goluri
+    float sx = segment->x1 - ux * half + 0.5f;
+    float sy = segment->y1 - uy * half + 0.5f;
+    float ex = segment->x2 + ux * half + 0.5f;
+    float ey = segment->y2 + uy * half + 0.5f;
+
+    SDL_Color solid = {255, 255, 255, 255};
+    SDL_Color clear = {255, 255, 255, 0};
+    // sectiunea transversala: [-half-1 transparent], [-half opac], [+half opac], [+half+1 transparent]
+    float offsets[4] = {-half - 1.0f, -half, half, half + 1.0f};
+    int rows = stroke_antialiased ? 4 : 2;
+    int first = stroke_antialiased ? 0 : 1;
+
+    int base = figure->vertex_count;
+    for (int r = 0; r < rows; r++) {
+        float o = offsets[first + r];
+        SDL_Color color = (first + r == 0 || first + r == 3) ? clear : solid;
+        figure->vertices[figure->vertex_count++] = (SDL_Vertex){{sx + nx * o, sy + ny * o}, color, {0, 0}};
+        figure->vertices[figure->vertex_count++] = (SDL_Vertex){{ex + nx * o, ey + ny * o}, color, {0, 0}};
+    }
+    for (int r = 0; r + 1 < rows; r++) {
+        int a = base + r * 2;   // start, end pe randul r
+        int b = a + 2;          // start, end pe randul r + 1
+        int* idx = &figure->indices[*index_count];
+        idx[0] = a;
+        idx[1] = a + 1;
+        idx[2] = b + 1;
+        idx[3] = a;
+        idx[4] = b + 1;
+        idx[5] = b;
+        *index_count += 6;
+    }
+}
+#endif
+
+// Aceleasi coordonate ca desenul original cu SDL_RenderDrawLine, inclusiv trunchierea la int a cercului.
+static void gallows_build(GallowsFigure* figure, int x_offset, int y_offset, bool mirrored) {
+    memset(figure, 0, sizeof(GallowsFigure));
+    figure->x_offset = x_offset;
+    figure->y_offset = y_offset;
+    figure->mirrored = mirrored;
+
+    int dir = mirrored ? -1 : 1;                //algoritm pentru pozitionarea in oglinda
+    int base_x = 150 + x_offset;
+    int top = 200 + y_offset;
+    int bottom = 350 + y_offset;
+    int rope_x = base_x + 100 * dir;
+    int center_x = rope_x;
+    int center_y = top + 25 + 25;
+    int radius = 25;
+
+    SDL_Point head[GALLOWS_HEAD_SEGMENTS];
+    for (int i = 0; i < GALLOWS_HEAD_SEGMENTS; i++) {
+        double angle = i * 5 * M_PI / 180.0;
+        head[i].x = center_x + radius * cos(angle);
+        head[i].y = center_y + radius * sin(angle);
+    }
+
+    GallowsSegment segments[GALLOWS_MAX_SEGMENTS];
+    int segment_count = 0;
+    int segment_stage[GALLOWS_STAGE_COUNT];
+    // baza, verticala, orizontala, funia
+    segments[segment_count++] = (GallowsSegment){base_x - 50 * dir, bottom, base_x + 50 * dir, bottom};
+    segments[segment_count++] = (GallowsSegment){base_x, top, base_x, bottom};
+    segments[segment_count++] = (GallowsSegment){base_x, top, rope_x, top};
+    segments[segment_count++] = (GallowsSegment){rope_x, top, rope_x, top + 25};
+    segment_stage[0] = segment_count;
+    // cap
+    for (int i = 0; i < GALLOWS_HEAD_SEGMENTS; i++) {
+        SDL_Point a = head[i];
+        SDL_Point b = head[(i + 1) % GALLOWS_HEAD_SEGMENTS];
+        segments[segment_count++] = (GallowsSegment){a.x, a.y, b.x, b.y};
+    }
+    segment_stage[1] = segment_count;
+    // corp, maini, picioare
+    segments[segment_count++] = (GallowsSegment){center_x, top + 75, center_x, top + 150};
+    segment_stage[2] = segment_count;
+    segments[segment_count++] = (GallowsSegment){center_x, top + 100, center_x - 30 * dir, top + 130};
+    segment_stage[3] = segment_count;
+    segments[segment_count++] = (GallowsSegment){center_x, top + 100, center_x + 30 * dir, top + 130};
+    segment_stage[4] = segment_count;
+    segments[segment_count++] = (GallowsSegment){center_x, top + 150, center_x - 30 * dir, top + 190};
+    segment_stage[5] = segment_count;
+    segments[segment_count++] = (GallowsSegment){center_x, top + 150, center_x + 30 * dir, top + 190};
+    segment_stage[6] = segment_count;
+
+    // linia franta pentru SDL_RenderDrawLines
+    int count = 0;
+    gallows_add_point(figure, &count, base_x + 50 * dir, bottom);
+    gallows_add_point(figure, &count, base_x - 50 * dir, bottom);
+    gallows_add_point(figure, &count, base_x, bottom);
+    gallows_add_point(figure, &count, base_x, top);
+    gallows_add_point(figure, &count, rope_x, top);
+    gallows_add_point(figure, &count, rope_x, top + 25);
+    figure->point_count[0] = count;
+    // capul incepe sus (270 de grade), unde se termina funia, si face un cerc complet
+    const int head_top = 270 / 5;
+    const int head_bottom = 90 / 5;
+    // (trunchierea poate muta punctul de sus cu un pixel fata de capatul funiei)
+    gallows_add_point(figure, &count, head[head_top].x, head[head_top].y);
+    for (int i = 1; i <= GALLOWS_HEAD_SEGMENTS; i++) {
+        SDL_Point p = head[(head_top + i) % GALLOWS_HEAD_SEGMENTS];
+        gallows_add_point(figure, &count, p.x, p.y);
+    }
+    figure->point_count[1] = count;
+    // se coboara pe cerc pana jos, de unde porneste corpul
+    for (int i = 1; i <= (head_bottom - head_top + GALLOWS_HEAD_SEGMENTS) % GALLOWS_HEAD_SEGMENTS; i++) {
+        SDL_Point p = head[(head_top + i) % GALLOWS_HEAD_SEGMENTS];
+        gallows_add_point(figure, &count, p.x, p.y);
+    }
+    gallows_add_point(figure, &count, center_x, top + 150);
+    figure->point_count[2] = count;
+    gallows_add_point(figure, &count, center_x, top + 100);
+    gallows_add_point(figure, &count, center_x - 30 * dir, top + 130);
+    figure->point_count[3] = count;
+    gallows_add_point(figure, &count, center_x, top + 100);
+    gallows_add_point(figure, &count, center_x + 30 * dir, top + 130);
+    figure->point_count[4] = count;
+    gallows_add_point(figure, &count, center_x, top + 100);
+    gallows_add_point(figure, &count, center_x, top + 150);
+    gallows_add_point(figure, &count, center_x - 30 * dir, top + 190);
+    figure->point_count[5] = count;
+    gallows_add_point(figure, &count, center_x, top + 150);
+    gallows_add_point(figure, &count, center_x + 30 * dir, top + 190);
+    figure->point_count[6] = count;
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    if (gallows_uses_geometry()) {
+        int index_count = 0;
+        int stage = 0;
+        for (int i = 0; i < segment_count; i++) {
+            gallows_add_stroke(figure, &index_count, &segments[i]);
+            while (stage < GALLOWS_STAGE_COUNT && i + 1 == segment_stage[stage]) {
+                figure->index_count[stage++] = index_count;
+            }
+        }
+    }
+#else
+    (void)segment_stage;
+#endif
+}
+
+static const GallowsFigure* gallows_get(int x_offset, int y_offset, bool mirrored) {
+    for (int i = 0; i < figure_cache_count; i++) {
+        GallowsFigure* figure = &figure_cache[i];
+        if (figure->x_offset == x_offset && figure->y_offset == y_offset && figure->mirrored == mirrored) {
+            return figure;
+        }
+    }
+    GallowsFigure* figure;
+    if (figure_cache_count < GALLOWS_CACHE_SIZE) {
+        figure = &figure_cache[figure_cache_count++];
+    } else {
+        figure = &figure_cache[figure_cache_next];
+        figure_cache_next = (figure_cache_next + 1) % GALLOWS_CACHE_SIZE;
+    }
+    gallows_build(figure, x_offset, y_offset, mirrored);
+    return figure;
+}
+
+void gallows_draw(SDL_Renderer* renderer, int wrong_guesses, int x_offset, int y_offset, bool mirrored) {
+    if (renderer == NULL) {
+        return;
+    }
+    if (wrong_guesses < 0) wrong_guesses = 0;
+    if (wrong_guesses >= GALLOWS_STAGE_COUNT) wrong_guesses = GALLOWS_STAGE_COUNT - 1;
+    const GallowsFigure* figure = gallows_get(x_offset, y_offset, mirrored);
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    if (gallows_uses_geometry() && figure->index_count[wrong_guesses] > 0) {
+        SDL_BlendMode previous_mode;
+        SDL_GetRenderDrawBlendMode(renderer, &previous_mode);
+        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND); // pentru marginile transparente
+        int result = SDL_RenderGeometry(renderer, NULL, figure->vertices, figure->vertex_count,
+                                        figure->indices, figure->index_count[wrong_guesses]);
+        SDL_SetRenderDrawBlendMode(renderer, previous_mode);
+        if (result == 0) {
+            return;
+        }
+        // renderer-ul nu stie geometrie: liniile simple de mai jos
+    }
+#endif
+    SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
+    SDL_RenderDrawLines(renderer, figure->points, figure->point_count[wrong_guesses]);
+}
+
+void gallows_set_stroke(float width, bool antialiased) {
+    if (width < 1.0f) width = 1.0f;
+    if (width > GALLOWS_MAX_STROKE_WIDTH) width = GALLOWS_MAX_STROKE_WIDTH;
+    if (width == stroke_width && antialiased == stroke_antialiased) {
+        return;
+    }
+    stroke_width = width;
+    stroke_antialiased = antialiased;
+    gallows_cache_clear(); // geometria depinde de grosime
+}
+
+void gallows_cache_clear(void) {
+    figure_cache_count = 0;
+    figure_cache_next = 0;
+}
@@ -0,0 +1,24 @@
+#ifndef __GALLOWS__
+#define __GALLOWS__
+
+#include <SDL2/SDL.h>
+#include <stdbool.h>
+
+#define GALLOWS_STAGE_COUNT 7        // 0 = doar spanzuratoarea, 6 = omul intreg
+#define GALLOWS_HEAD_SEGMENTS 72     // cercul capului, din 5 in 5 grade
+#define GALLOWS_CACHE_SIZE 4         // pozitii diferite pe ecran (versus are 2)
+
+// Grosimea si anti-aliasing-ul liniilor; 1 px fara AA = exact desenul vechi cu SDL_RenderDrawLines.
+// Liniile groase/AA sunt triunghiuri precalculate, trimise cu un singur SDL_RenderGeometry (SDL >= 2.0.18).
+#ifndef GALLOWS_STROKE_WIDTH
+#define GALLOWS_STROKE_WIDTH 1.0f
+#endif
+#ifndef GALLOWS_STROKE_ANTIALIAS
+#define GALLOWS_STROKE_ANTIALIAS 0
+#endif
+
+void gallows_draw(SDL_Renderer* renderer, int wrong_guesses, int x_offset, int y_offset, bool mirrored);
+void gallows_set_stroke(float width, bool antialiased);
+void gallows_cache_clear(void);
+
+#endif // __GALLOWS__
@@ -7,8 +7,14 @@
 #include "normal_mode.h"
 #include "hard_mode.h"
 #include "versus_mode.h"
+#include "evil_mode.h"
+#include "dictionary_cache.h"
+#include "perf.h"
+#include "frame_pacer.h"
+#include "log.h"
 int main() {
     Game game = {0};
+    log_init(LOG_FILE_PATH); // primul: si erorile de initializare ajung in jurnal
 
     if (!initialize_game(&game)) {
         cleanup_game(&game);
@@ -19,11 +25,50 @@ int main() {
         cleanup_game(&game);
         return 1;
     }
+    // dictionarul limbii curente se incarca pe un fir separat cat timp meniul e afisat
+    dictionary_cache_prefetch(game.current_language);
+
+    // numele functiei de render pentru fiecare GameState, afisat in overlay-ul de performanta
+    static const char* render_labels[] = {"render_main_menu", "normal_mode_render", "hard_mode_render", "versus_mode_render", "evil_mode_render"};
+
+    FramePacer pacer;
+    frame_pacer_init(&pacer, game.window, game.renderer);
 
     bool running = true;
+    bool was_animating = true; // primul frame se deseneaza oricum
     while (running) {
+        // cand nimic nu se misca (sau fereastra nu se vede) se asteapta un eveniment in loc sa se redeseneze acelasi frame;
+        // dupa ultimul frame animat se mai deseneaza unul, ca ecranul sa ramana in starea finala (ex. fara bara de progres)
+        bool visible = frame_pacer_window_visible(game.window);
+        bool animating = game_is_animating(&game);
+        bool idle = !visible || (!animating && !was_animating);
+        was_animating = animating;
+        if (idle) {
+            if (!frame_pacer_wait_for_event(&pacer, FRAME_PACER_IDLE_WAIT_MS) && !game_is_animating(&game)) {
+                update_game(&game); // fara eveniment, dar ceasul simularii si dictionarele din fundal merg mai departe
+                continue;
+            }
+            visible = frame_pacer_window_visible(game.window);
+        }
+        if (!visible) {
+            // minimizata/ascunsa: evenimentele si timerele merg mai departe, dar nu se deseneaza (si nu se masoara) nimic
+            handle_events(&game);
+            update_game(&game);
+            continue;
+        }
+
+        perf_frame_begin();
+
+        perf_phase_begin(PERF_PHASE_EVENTS);
         handle_events(&game);
+        perf_phase_end(PERF_PHASE_EVENTS);
 
+        perf_phase_begin(PERF_PHASE_UPDATE);
+        update_game(&game);
+        perf_phase_end(PERF_PHASE_UPDATE);
+
+        perf_phase_begin(PERF_PHASE_RENDER);
+        GameState rendered_state = game.current_state;
         SDL_SetRenderDrawColor(game.renderer, 0, 0, 0, 255);
         SDL_RenderClear(game.renderer);
 
@@ -40,10 +85,24 @@ int main() {
             case VERSUS_MODE:
                 versus_mode_render(&game); 
                 break;
+            case EVIL_MODE:
+                evil_mode_render(&game);
+                break;
         }
+        perf_phase_end(PERF_PHASE_RENDER);
 
+        if (perf_overlay_visible()) {
+            perf_phase_begin(PERF_PHASE_OVERLAY);
+            perf_overlay_render(game.renderer);
+            perf_phase_end(PERF_PHASE_OVERLAY);
+        }
+
+        perf_phase_begin(PERF_PHASE_PRESENT);
         SDL_RenderPresent(game.renderer);
-        SDL_Delay(16);
+        perf_phase_end(PERF_PHASE_PRESENT);
+
+        perf_frame_end(render_labels[rendered_state]);
+        frame_pacer_end_frame(&pacer);
     }
 
     cleanup_game(&game);
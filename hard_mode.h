@@ -14,8 +14,6 @@ void hard_mode_handle_event(Game* game, SDL_Event* event);
 void hard_mode_render(Game* game);
 
 // Helper functions specific to Hard Mode logic
-char* hard_mode_get_random_word_by_length(HangmanGame* hangman, int length);
 void hard_mode_process_key(Game* game, char key);
-void hard_mode_update_displayed_word(Game* game);
 
 #endif // __HARD_MODE__
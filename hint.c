@@ -0,0 +1,251 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+
+#include "hint.h"
+#include "log.h"
+
+#define HINT_ALL_LETTERS ((1u << PATTERN_ALPHABET_SIZE) - 1)
+#define HINT_SMALL_COUNTS 256   // k * log2 k tabelat pentru grupurile mici, majoritatea
+
+static double hint_k_log_k_table[HINT_SMALL_COUNTS];
+static pthread_once_t hint_k_log_k_once = PTHREAD_ONCE_INIT; // hint-uri pe mai multe fire (botul din versus, simulari)
+
+static void hint_fill_k_log_k_table(void) {
+    for (int k = 1; k < HINT_SMALL_COUNTS; k++) {
+        hint_k_log_k_table[k] = k * log2((double)k);
+    }
+}
+
+static double hint_k_log_k(int k) {
+    if (k < HINT_SMALL_COUNTS) {
+        return hint_k_log_k_table[k];
+    }
+    return k * log2((double)k);
+}
+
+void hint_init(HintState* hint, PatternIndex* patterns) {
+    if (hint == NULL) {
+        return;
+    }
+    hint_free(hint);
+    hint->patterns = patterns;
+    // aici, nu la prima tabela exacta: si calculul lovit/ratat foloseste hint_k_log_k
+    pthread_once(&hint_k_log_k_once, hint_fill_k_log_k_table);
+}
+
+void hint_free(HintState* hint) {
+    if (hint == NULL) {
+        return;
+    }
+    free(hint->candidates);
+    free(hint->outcomes);
+    free(hint->touched);
+    memset(hint, 0, sizeof(HintState));
+}
+
+void hint_set_book(HintState* hint, const OpeningBook* book) {
+    if (hint != NULL) {
+        hint->book = book;
+    }
+}
+
+// Ce stie jucatorul: litera descoperita pe fiecare pozitie din displayed_word (restul '_').
+static uint32_t hint_revealed(const HangmanGame* hangman, char* pattern, uint32_t* unknown_positions) {
+    uint32_t revealed_mask = 0;
+    *unknown_positions = 0;
+    for (int p = 0; p < hangman->word_length; p++) {
+        char c = hangman->displayed_word[2 * p];
+        pattern[p] = c;
+        if (c >= 'A' && c <= 'Z') {
+            revealed_mask |= 1u << (c - 'A');
+        } else {
+            *unknown_positions |= 1u << p;
+        }
+    }
+    pattern[hangman->word_length] = '\0';
+    return revealed_mask;
+}
+
+static bool hint_rebuild(HintState* hint, const HangmanGame* hangman) {
+    hint->bucket = pattern_index_bucket(hint->patterns, hangman->word_length);
+    hint->candidate_count = 0;
+    hint->applied_mask = 0;
+    hint->word[0] = '\0';
+    if (hint->bucket == NULL) {
+        return false;
+    }
+    if (hint->capacity_blocks < hint->bucket->block_count) {
+        uint64_t* candidates = (uint64_t*)realloc(hint->candidates, (size_t)hint->bucket->block_count * sizeof(uint64_t));
+        if (!candidates) {
+            LOG_ERROR(LOG_CAT_RULES, "hint_rebuild: Failed to allocate %d candidate blocks.", hint->bucket->block_count);
+            hint->bucket = NULL;
+            return false;
+        }
+        hint->candidates = candidates;
+        hint->capacity_blocks = hint->bucket->block_count;
+    }
+
+    char pattern[MAX_WORD_LENGTH + 1];
+    uint32_t revealed_mask = hint_revealed(hangman, pattern, &hint->unknown_positions);
+    // literele gresite = incercate, dar nedescoperite
+    hint->candidate_count = pattern_bucket_query(hint->bucket, pattern, hangman->guessed_mask & ~revealed_mask, hint->candidates);
+    hint->applied_mask = hangman->guessed_mask;
+    strcpy(hint->word, hangman->word);
+    return hint->candidate_count > 0;
+}
+
+bool hint_update(HintState* hint, const HangmanGame* hangman) {
+    if (hint == NULL || hangman == NULL || !hint->active || hint->patterns == NULL) {
+        return false;
+    }
+    // runda noua (alt cuvant, sau ghicitori sterse de un reset): de la zero
+    if (hint->bucket == NULL || hint->bucket->length != hangman->word_length ||
+        (hint->applied_mask & ~hangman->guessed_mask) != 0 || strcmp(hint->word, hangman->word) != 0) {
+        return hint_rebuild(hint, hangman);
+    }
+
+    uint32_t fresh = hangman->guessed_mask & ~hint->applied_mask;
+    while (fresh && hint->candidate_count > 0) {
+        int letter = __builtin_ctz(fresh);
+        fresh &= fresh - 1;
+        uint32_t positions = 0;
+        for (int p = 0; p < hangman->word_length; p++) {
+            if (hangman->displayed_word[2 * p] == 'A' + letter) {
+                positions |= 1u << p;
+            }
+        }
+        hint->candidate_count = pattern_bucket_apply_guess(hint->bucket, hint->candidates, letter,
+                                                           positions, hint->unknown_positions);
+        hint->unknown_positions &= ~positions;
+    }
+    hint->applied_mask = hangman->guessed_mask;
+    return hint->candidate_count > 0;
+}
+
+static bool hint_reserve_table(HintState* hint) {
+    if (hint->outcomes) {
+        return true;
+    }
+    hint->outcomes = (HintOutcome*)calloc(HINT_TABLE_SIZE, sizeof(HintOutcome));
+    hint->touched = (int*)malloc(HINT_EXACT_BUDGET * sizeof(int));
+    if (!hint->outcomes || !hint->touched) {
+        LOG_ERROR(LOG_CAT_RULES, "hint_reserve_table: Failed to allocate the outcome table.");
+        free(hint->outcomes);
+        free(hint->touched);
+        hint->outcomes = NULL;
+        hint->touched = NULL;
+        return false;
+    }
+    return true;
+}
+
+// Pentru fiecare litera, sum(k * log2 k) peste rezultatele ei (multimea de pozitii unde apare,
+// k = cati candidati dau acelasi rezultat); hits = cati candidati o contin.
+static void hint_exact_partitions(HintState* hint, uint32_t letters, double* sum_k_log_k, int* hits) {
+    const PatternBucket* bucket = hint->bucket;
+    int touched_count = 0;
+
+    for (int j = pattern_bucket_next(bucket, hint->candidates, 0); j >= 0; j = pattern_bucket_next(bucket, hint->candidates, j + 1)) {
+        const char* word = pattern_bucket_word(bucket, j);
+        uint32_t positions[PATTERN_ALPHABET_SIZE];
+        uint32_t present = 0;
+        uint32_t unknown = hint->unknown_positions;
+        while (unknown) {
+            int p = __builtin_ctz(unknown);
+            unknown &= unknown - 1;
+            int letter = word[p] - 'A';
+            if (!(letters & (1u << letter))) {
+                continue;
+            }
+            if (!(present & (1u << letter))) {
+                present |= 1u << letter;
+                positions[letter] = 0;
+            }
+            positions[letter] |= 1u << p;
+        }
+        while (present) {
+            int letter = __builtin_ctz(present);
+            present &= present - 1;
+            hits[letter]++;
+            uint64_t key = ((uint64_t)(letter + 1) << 32) | positions[letter];
+            uint32_t slot = (uint32_t)((key * 0x9E3779B97F4A7C15ull) >> 32) & (HINT_TABLE_SIZE - 1);
+            while (hint->outcomes[slot].key != 0 && hint->outcomes[slot].key != key) {
+                slot = (slot + 1) & (HINT_TABLE_SIZE - 1);
+            }
+            if (hint->outcomes[slot].key == 0) {
+                hint->outcomes[slot].key = key;
+                hint->touched[touched_count++] = (int)slot;
+            }
+            hint->outcomes[slot].count++;
+        }
+    }
+
+    for (int i = 0; i < touched_count; i++) {
+        HintOutcome* outcome = &hint->outcomes[hint->touched[i]];
+        int letter = (int)(outcome->key >> 32) - 1;
+        sum_k_log_k[letter] += hint_k_log_k(outcome->count);
+        outcome->key = 0;
+        outcome->count = 0;
+    }
+}
+
+int hint_best_letter(HintState* hint, const HangmanGame* hangman) {
+    if (hint == NULL || hangman == NULL || hint->patterns == NULL) {
+        return -1;
+    }
+    // tabla e in cartea de deschideri: nicio intrebare pe candidati (filtrarea porneste la primul hint din afara ei)
+    int book_letter = opening_book_letter(hint->book, hangman, NULL);
+    if (book_letter >= 0) {
+        LOG_DEBUG(LOG_CAT_RULES, "hint_best_letter: %s is in the opening book, suggesting %c.", hangman->displayed_word, 'A' + book_letter);
+        return book_letter;
+    }
+    hint->active = true;
+    if (!hint_update(hint, hangman)) {
+        LOG_DEBUG(LOG_CAT_RULES, "hint_best_letter: No dictionary word matches %s.", hangman->displayed_word);
+        return -1;
+    }
+
+    int n = hint->candidate_count;
+    uint32_t letters = ~hangman->guessed_mask & HINT_ALL_LETTERS;
+    double sum_k_log_k[PATTERN_ALPHABET_SIZE] = {0};
+    int hits[PATTERN_ALPHABET_SIZE] = {0};
+    bool exact = (long)n * __builtin_popcount(hint->unknown_positions) <= HINT_EXACT_BUDGET && hint_reserve_table(hint);
+    if (exact) {
+        hint_exact_partitions(hint, letters, sum_k_log_k, hits);
+    } else {
+        // prea multi candidati pentru frame: doar lovit/ratat, 26 de popcount-uri pe bitseturi
+        uint32_t remaining = letters;
+        while (remaining) {
+            int letter = __builtin_ctz(remaining);
+            remaining &= remaining - 1;
+            hits[letter] = pattern_bitset_and_count(hint->candidates, pattern_bucket_letter_bits(hint->bucket, letter),
+                                                    hint->bucket->block_count);
+            sum_k_log_k[letter] = hint_k_log_k(hits[letter]);
+        }
+    }
+
+    // entropia rezultatului = log2 n - (sum k log2 k) / n, ratarea fiind un rezultat cu k = n - hits;
+    // la egalitate (ex. un singur candidat) castiga litera cu mai putine ratari
+    int best = -1;
+    double best_entropy = -1.0;
+    while (letters) {
+        int letter = __builtin_ctz(letters);
+        letters &= letters - 1;
+        if (hits[letter] == 0) {
+            continue;
+        }
+        int misses = n - hits[letter];
+        double sum = sum_k_log_k[letter] + hint_k_log_k(misses);
+        double entropy = log2((double)n) - sum / n;
+        if (entropy > best_entropy + 1e-9 || (entropy > best_entropy - 1e-9 && hits[letter] > hits[best])) {
+            best = letter;
+            best_entropy = entropy;
+        }
+    }
+    LOG_DEBUG(LOG_CAT_RULES, "hint_best_letter: %d candidates, %s, suggesting %c (%.2f bits).", n,
+              exact ? "exact" : "hit/miss", best >= 0 ? 'A' + best : '-', best_entropy);
+    return best;
+}
@@ -0,0 +1,53 @@
+#ifndef __HINT__
+#define __HINT__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "rules.h"
+#include "pattern_index.h"
+#include "opening_book.h"
+
+// Sugestia "ce litera sa incerc": multimea cuvintelor din dictionar inca posibile pentru ce vede
+// jucatorul (displayed_word + literele gresite) si litera care aduce cea mai multa informatie.
+// Candidatii sunt un bitset peste bucket-ul lungimii cuvantului (pattern_index.h); dupa o intrebare
+// completa la cuvant nou, fiecare litera incercata doar taie din el (hint_update, din *_process_key).
+// Nu se uita la cuvantul secret decat ca sa stie cand s-a schimbat runda.
+// Primele litere ale rundei (cand candidatii sunt cei mai multi) vin din cartea de deschideri, daca exista.
+// Un calcul incape in bugetul unui frame (~1 ms si pe dictionarele de 10M cuvinte). Un HintState e al unui
+// singur fir; mai multe fire pot avea cate unul peste acelasi index, daca bucket-urile sunt deja construite.
+
+// Pana la atatea perechi (candidat, pozitie necunoscuta) castigul se calculeaza exact, pe toate
+// rezultatele posibile (pozitiile unde ar aparea litera); peste, doar din probabilitatea lovit/ratat.
+#define HINT_EXACT_BUDGET 16384
+#define HINT_TABLE_SIZE (2 * HINT_EXACT_BUDGET)   // putere a lui 2, ocupata cel mult pe jumatate
+
+typedef struct HintOutcome {
+    uint64_t key;    // (litera + 1) << 32 | pozitiile; 0 = slot liber
+    int count;
+} HintOutcome;
+
+typedef struct HintState {
+    PatternIndex* patterns;          // imprumutat (dictionary_cache), NULL = fara hint-uri
+    const OpeningBook* book;         // imprumutat, read-only, NULL = totul live
+    const PatternBucket* bucket;     // NULL pana la primul hint, sau daca nu exista cuvinte de lungimea asta
+    bool active;                     // jucatorul a cerut cel putin un hint: de acum filtrarea tine pasul cu jocul
+    uint64_t* candidates;
+    int capacity_blocks;
+    int candidate_count;
+    uint32_t unknown_positions;      // pozitiile inca ascunse pentru care sunt valabili candidatii
+    uint32_t applied_mask;           // literele deja aplicate pe candidati
+    char word[MAX_WORD_LENGTH + 1];  // runda pentru care sunt valabili candidatii
+    HintOutcome* outcomes;           // HINT_TABLE_SIZE, alocat la primul calcul exact
+    int* touched;                    // sloturile folosite, ca tabela sa fie golita fara memset
+} HintState;
+
+void hint_init(HintState* hint, PatternIndex* patterns);
+void hint_free(HintState* hint);
+void hint_set_book(HintState* hint, const OpeningBook* book);   // dupa hint_init
+// Aduce candidatii la zi cu hangman: filtrare incrementala cu literele noi, sau intrebare completa
+// cand runda s-a schimbat. Nu face nimic pana la primul hint. false daca nu exista candidati.
+bool hint_update(HintState* hint, const HangmanGame* hangman);
+// 0..25 = litera recomandata ('A' + rezultat), -1 daca nu se poate recomanda nimic
+int hint_best_letter(HintState* hint, const HangmanGame* hangman);
+
+#endif // __HINT__
@@ -13,23 +13,28 @@
 #include "normal_mode.h" 
 #include "hard_mode.h"   
 #include "versus_mode.h"
+#include "evil_mode.h"
+#include "text_atlas.h"
+#include "gallows.h"
+#include "dictionary_cache.h"
+#include "perf.h"
+#include "log.h"
 #define WINDOW_TITLE "HANGMAN"
 
 #define IMAGE_FLAGS IMG_INIT_PNG
 
-void render_text(SDL_Renderer* renderer, TTF_Font* font, const char* text, SDL_Color color, int x, int y) {
-    if (!font) {
-        fprintf(stderr, "Error at loading font\n");
-        return;
-    }
+// varianta veche: textul e rasterizat la fiecare apel (folosita doar pentru caractere din afara atlasului)
+static void render_text_uncached(SDL_Renderer* renderer, TTF_Font* font, const char* text, SDL_Color color, int x, int y) {
     SDL_Surface* surface = TTF_RenderText_Blended(font, text, color);
+    perf_count(PERF_COUNTER_TEXT_RASTER, 1);
     if (!surface) {
-        fprintf(stderr, "Error at creating text surface\n");
+        LOG_ERROR(LOG_CAT_GAME, "Error at creating text surface");
         return;
     }
+    perf_count(PERF_COUNTER_TEXTURE_CREATE, 1);
     SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface); //din surface care e pe CPU face in texture care e pe GPU(cred)
     if (!texture) {
-        fprintf(stderr, "Error at creating text texture\n");
+        LOG_ERROR(LOG_CAT_GAME, "Error at creating text texture");
         SDL_FreeSurface(surface);
         return;
     }
@@ -39,96 +44,51 @@ void render_text(SDL_Renderer* renderer, TTF_Font* font, const char* text, SDL_C
     SDL_FreeSurface(surface);
 }
 
-void render_hangman_image(SDL_Renderer* renderer, int wrong_guesses, int x_offset, int y_offset, bool mirrored) {
-    SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255); 
-    int initial_gallows_x = 150;
-    int gallows_top = 200 + y_offset;
-    int gallows_bottom = 350 + y_offset;
-    int base_left_x;
-    int base_right_x;
-    int vertical_post_x;
-    int horizontal_beam_start_x;
-    int horizontal_beam_end_x;
-    int rope_x;
-    int current_gallows_base_x = initial_gallows_x + x_offset;
-
-    if (mirrored) {
-        base_left_x = current_gallows_base_x + 50;
-        base_right_x = current_gallows_base_x - 50;
-        vertical_post_x = current_gallows_base_x;
-        horizontal_beam_start_x = current_gallows_base_x;
-        horizontal_beam_end_x = current_gallows_base_x - 100; 
-        rope_x = horizontal_beam_end_x; 
-    } else {
-        base_left_x = current_gallows_base_x - 50;
-        base_right_x = current_gallows_base_x + 50;
-        vertical_post_x = current_gallows_base_x;         //algoritm pentru pozitionarea in oglinda
-        horizontal_beam_start_x = current_gallows_base_x;
-        horizontal_beam_end_x = current_gallows_base_x + 100; 
-        rope_x = current_gallows_base_x + 100; 
-    }
-
-    
-    SDL_RenderDrawLine(renderer, base_left_x, gallows_bottom, base_right_x, gallows_bottom);
-    // verticala
-    SDL_RenderDrawLine(renderer, vertical_post_x, gallows_top, vertical_post_x, gallows_bottom);
-    // orizontala
-    SDL_RenderDrawLine(renderer, horizontal_beam_start_x, gallows_top, horizontal_beam_end_x, gallows_top);
-    // funia
-    SDL_RenderDrawLine(renderer, rope_x, gallows_top, rope_x, gallows_top + 25);
-
-
-    int centerX = rope_x; 
-    int centerY = gallows_top + 25 + 25;
-    int radius = 25;
-
-    // cap
-    if (wrong_guesses >= 1) {
-        for (int i = 0; i < 360; i = i + 5) {
-            double angle = i * M_PI / 180.0;
-            int x1 = centerX + radius * cos(angle);
-            int y1 = centerY + radius * sin(angle);
-            double next_angle = (i + 5) * M_PI / 180.0;
-            int x2 = centerX + radius * cos(next_angle);
-            int y2 = centerY + radius * sin(next_angle);
-            SDL_RenderDrawLine(renderer, x1, y1, x2, y2);
-        }
-    }
-    // corp
-    if (wrong_guesses >= 2) {
-        SDL_RenderDrawLine(renderer, centerX, gallows_top + 75, centerX, gallows_top + 150);
-    }
-    // mana stanga
-    if (wrong_guesses >= 3) {
-        SDL_RenderDrawLine(renderer, centerX, gallows_top + 100, centerX + (mirrored ? 30 : -30), gallows_top + 130);
-    }
-    //mana dreapta
-    if (wrong_guesses >= 4) { 
-        SDL_RenderDrawLine(renderer, centerX, gallows_top + 100, centerX + (mirrored ? -30 : 30), gallows_top + 130);
+void render_text(SDL_Renderer* renderer, TTF_Font* font, const char* text, SDL_Color color, int x, int y) {
+    if (!font) {
+        LOG_ERROR(LOG_CAT_GAME, "Error at loading font");
+        return;
     }
-    // picioar stang
-    if (wrong_guesses >= 5) { 
-        SDL_RenderDrawLine(renderer, centerX, gallows_top + 150, centerX + (mirrored ? 30 : -30), gallows_top + 190);
+    if (!text || text[0] == '\0') {
+        return;
     }
-    //picior drept
-    if (wrong_guesses >= 6) {
-        SDL_RenderDrawLine(renderer, centerX, gallows_top + 150, centerX + (mirrored ? -30 : 30), gallows_top + 190);
+    // glyph-urile sunt rasterizate o data in atlas, textul se deseneaza din quad-uri
+    TextAtlas* atlas = text_atlas_get(renderer, font);
+    if (atlas && text_atlas_supports(text)) {
+        text_atlas_draw(atlas, text, color, x, y);
+        return;
     }
+    render_text_uncached(renderer, font, text, color, x, y);
+}
+
+// Geometria fiecarei etape e precalculata in gallows.c (fara cos/sin pe frame) si trimisa intr-un singur apel.
+void render_hangman_image(SDL_Renderer* renderer, int wrong_guesses, int x_offset, int y_offset, bool mirrored) {
+    gallows_draw(renderer, wrong_guesses, x_offset, y_offset, mirrored);
+}
+
+// ceasul si RNG-ul jocului din fereastra; simularile headless dau alt RulesEnv acelorasi reguli
+static long interface_rules_clock(void* clock_data) {
+    return ((const Game*)clock_data)->sim_time_ms;
+}
+
+static unsigned int interface_rules_rand(void* rand_data) {
+    (void)rand_data;
+    return word_index_rand();
 }
 
 bool initialize_game(Game* game) {
     if (SDL_Init(SDL_INIT_EVERYTHING) < 0) {
-        fprintf(stderr, "SDL initialization error: %s\n", SDL_GetError());
+        LOG_ERROR(LOG_CAT_GAME, "SDL initialization error: %s", SDL_GetError());
         return false;
     }
 
     if (!(IMG_Init(IMAGE_FLAGS) & IMAGE_FLAGS)) {
-        fprintf(stderr, "SDL_image initialization error: %s\n", IMG_GetError());
+        LOG_ERROR(LOG_CAT_GAME, "SDL_image initialization error: %s", IMG_GetError());
         return false;
     }
 
     if (TTF_Init() < 0) {
-        fprintf(stderr, "SDL_ttf initialization error: %s\n", TTF_GetError());
+        LOG_ERROR(LOG_CAT_GAME, "SDL_ttf initialization error: %s", TTF_GetError());
         return false;
     }
 
@@ -139,19 +99,23 @@ bool initialize_game(Game* game) {
                                    HEIGHT,
                                    SDL_WINDOW_SHOWN);
     if (!game->window) {
-        fprintf(stderr, "Window creation error: %s\n", SDL_GetError());
+        LOG_ERROR(LOG_CAT_GAME, "Window creation error: %s", SDL_GetError());
         return false;
     }
 
     game->renderer = SDL_CreateRenderer(game->window, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
     if (!game->renderer) {
-        fprintf(stderr, "Renderer creation error: %s\n", SDL_GetError());
+        LOG_ERROR(LOG_CAT_GAME, "Renderer creation error: %s", SDL_GetError());
         return false;
     }
 
     game->current_state = MAIN_MENU;
+    game->pending_state = MAIN_MENU;
     game->hangman = NULL; // inca suntem in main menu
     game->current_language = LANG_ENGLISH;
+    game->rules_env = (RulesEnv){interface_rules_clock, game, interface_rules_rand, NULL, NULL};
+    game->sim_last_ticks = SDL_GetTicks();
+    game->sim_time_ms = (long)game->sim_last_ticks;
 
     game->flag_rect.w = 60; 
     game->flag_rect.h = 40; 
@@ -163,63 +127,61 @@ bool initialize_game(Game* game) {
 bool load_media(Game* game) {
     // initializarea backgroundului
     game->background = IMG_LoadTexture(game->renderer, "images/bg.jpg");
+    perf_count(PERF_COUNTER_TEXTURE_CREATE, 1);
     if (!game->background) {
-        fprintf(stderr, "Failed to load background image: %s\n", IMG_GetError());
+        LOG_ERROR(LOG_CAT_GAME, "Failed to load background image: %s", IMG_GetError());
         return false;
     }
 
     // font
     game->text_font = TTF_OpenFont("fonts/Freckle_Face/FreckleFace-Regular.ttf", FONT_SIZE);
     if (!game->text_font) {
-        fprintf(stderr, "Failed to load font: %s\n", TTF_GetError());
+        LOG_ERROR(LOG_CAT_GAME, "Failed to load font: %s", TTF_GetError());
         return false;
     }
 
     game->flag_en_texture = IMG_LoadTexture(game->renderer, "images/flag_en.png");
+    perf_count(PERF_COUNTER_TEXTURE_CREATE, 1);
     if (!game->flag_en_texture) {
-        fprintf(stderr, "WARNING: Failed to load English flag: %s\n", IMG_GetError());
+        LOG_WARN(LOG_CAT_GAME, "Failed to load English flag: %s", IMG_GetError());
     }
     game->flag_ro_texture = IMG_LoadTexture(game->renderer, "images/flag_ro.png");
+    perf_count(PERF_COUNTER_TEXTURE_CREATE, 1);
     if (!game->flag_ro_texture) {
-        fprintf(stderr, "WARNING: Failed to load Romanian flag: %s\n", IMG_GetError());
+        LOG_WARN(LOG_CAT_GAME, "Failed to load Romanian flag: %s", IMG_GetError());
     }
 
 
     // culoarea butonului
     SDL_Color button_color = {255, 255, 255, 255}; // Light grey
+    SDL_Color hover_color = {69, 192, 215, 255}; // albastru la hover
 
-    // normal Mode Button
-    game->buttons[BUTTON_NORMAL_MODE].rect = (SDL_Rect){WIDTH / 2 - 100, 550, 210, 65}; //e de tip SDL_Rect care are parametrii x,y,w,h
-    strcpy(game->buttons[BUTTON_NORMAL_MODE].text, "NORMAL MODE"); //se face un dreptunghi si se creeaza textul
-
-    // hard Mode Button
-    game->buttons[BUTTON_HARD_MODE].rect = (SDL_Rect){WIDTH / 2 - 100, 610, 210, 65};
-    strcpy(game->buttons[BUTTON_HARD_MODE].text, "HARD MODE");
-    
-    // versus Mode Button
-    game->buttons[BUTTON_VERSUS_MODE].rect = (SDL_Rect){WIDTH / 2 - 100, 670, 210, 65};
-    strcpy(game->buttons[BUTTON_VERSUS_MODE].text, "VERSUS MODE");
-
-    // language Button
-    game->buttons[BUTTON_LANGUAGE].rect = (SDL_Rect){WIDTH / 2 - 100, 730, 210, 65};
-    strcpy(game->buttons[BUTTON_LANGUAGE].text, "LANGUAGE");
-
-    //se ia fiecare buton in parte, se face suprafata, se pune font, text, si culoare pe acea suprafata
+    // fiecare buton are ambele stari (normal si hover) rasterizate acum, o singura data
+    static const char* button_texts[BUTTON_COUNT] = {"NORMAL MODE", "HARD MODE", "VERSUS MODE", "EVIL MODE", "LANGUAGE"};
     for (int i = 0; i < BUTTON_COUNT; i++) {
-        SDL_Surface* text_surface = TTF_RenderText_Blended(game->text_font, game->buttons[i].text, button_color);//se ia textu pus si se face
-        if (!text_surface) {                                                                                     //suprafata
-            fprintf(stderr, "Failed to create text surface for button %s: %s\n", game->buttons[i].text, TTF_GetError());
-            return false;
-        }
-        game->buttons[i].texture = SDL_CreateTextureFromSurface(game->renderer, text_surface);//suprafata se face textura
-        if (!game->buttons[i].texture) {
-            fprintf(stderr, "Failed to create texture for button %s: %s\n", game->buttons[i].text, SDL_GetError());
-            SDL_FreeSurface(text_surface);
+        SDL_Rect rect = {WIDTH / 2 - 100, 490 + i * 60, 210, 65}; //e de tip SDL_Rect care are parametrii x,y,w,h
+        if (!button_init(&game->buttons[i], game->renderer, game->text_font, button_texts[i], rect, button_color, hover_color)) {
             return false;
         }
-        SDL_FreeSurface(text_surface); // se elimina suprafata
     }
-    
+    button_group_init(&game->menu_buttons, game->buttons, BUTTON_COUNT);
+
+    // literele tastaturii: un singur atlas pentru toate modurile, culoarea se da la desenare
+    game->letter_atlas = text_atlas_get(game->renderer, game->text_font);
+    if (!game->letter_atlas) {
+        LOG_ERROR(LOG_CAT_GAME, "Failed to create letter atlas.");
+        return false;
+    }
+    for (int i = 0; i < ALPHABET_SIZE; i++) {
+        int row = i / KEYBOARD_COLS;
+        int col = i % KEYBOARD_COLS;
+        game->letter_rects[i] = (SDL_Rect){KEYBOARD_START_X + col * (KEY_WIDTH + KEY_SPACING),
+                                           KEYBOARD_START_Y + row * (KEY_HEIGHT + KEY_SPACING),
+                                           KEY_WIDTH, KEY_HEIGHT};
+    }
+
+    // overlay-ul de performanta (F3) e optional: fara font jocul merge mai departe
+    perf_overlay_init("fonts/Freckle_Face/FreckleFace-Regular.ttf");
     return true;
 }
 
@@ -227,12 +189,18 @@ void cleanup_game(Game* game) {
     normal_mode_cleanup(game);
     hard_mode_cleanup(game);
     versus_mode_cleanup(game);
+    evil_mode_cleanup(game);
+    parallel_pool_destroy(game->workers);
+    game->workers = NULL;
+    text_atlas_cache_clear(); // atlasele tin textura pe renderer si pointer la font
+    game->letter_atlas = NULL; // era unul din atlasele din cache
+    perf_overlay_cleanup();
+    render_layer_destroy(&game->board_layer);
+    render_layer_destroy(&game->overlay_layer);
+    dictionary_cache_shutdown(); // dupa ce modurile si-au dat inapoi dictionarele
     
     for (int i = 0; i < BUTTON_COUNT; i++) {
-        if (game->buttons[i].texture) {
-            SDL_DestroyTexture(game->buttons[i].texture);
-            game->buttons[i].texture = NULL; //se elimina fiecare textura creata
-        }
+        button_destroy(&game->buttons[i]); //se elimina fiecare textura creata (si daca load_media s-a oprit la jumatate)
     }
     if (game->background) {
         SDL_DestroyTexture(game->background);
@@ -261,56 +229,111 @@ void cleanup_game(Game* game) {
     TTF_Quit();
     IMG_Quit();
     SDL_Quit();
+    log_shutdown(); // ultimul: mesajele de mai sus ajung inca in fisier
+}
+
+
+// Intra efectiv in modul ales; dictionarul limbii curente e deja in cache (sau se incarca sincron).
+static void enter_game_mode(Game* game, GameState mode) {
+    normal_mode_cleanup(game);
+    hard_mode_cleanup(game);
+    versus_mode_cleanup(game);
+    evil_mode_cleanup(game);
+    game->current_state = mode;
+    switch (mode) {
+        case NORMAL_MODE:
+            normal_mode_init(game);
+            break;
+        case HARD_MODE:
+            hard_mode_init(game);
+            break;
+        case VERSUS_MODE:
+            versus_mode_init(game);
+            break;
+        case EVIL_MODE:
+            evil_mode_init(game);
+            break;
+        default:
+            break;
+    }
+    if ((game->current_state == NORMAL_MODE || game->current_state == HARD_MODE || 
+    game->current_state == VERSUS_MODE || game->current_state == EVIL_MODE) && game->hangman == NULL && game->versus_data == NULL) {
+        LOG_ERROR(LOG_CAT_GAME, "Error at initialing game mode.");
+        game->current_state = MAIN_MENU; // daca da fail sa se initializeze un mod de joc
+    }
+}
+
+// Daca dictionarul inca se incarca pe firul din fundal, meniul ramane activ (cu bara de progres)
+// si modul e pornit de update_pending_game_mode cand incarcarea s-a terminat.
+static void request_game_mode(Game* game, GameState mode) {
+    if (dictionary_cache_state(game->current_language, NULL) == DICTIONARY_CACHE_LOADING) {
+        game->pending_state = mode;
+        return;
+    }
+    game->pending_state = MAIN_MENU;
+    enter_game_mode(game, mode);
 }
 
+static void update_pending_game_mode(Game* game) {
+    dictionary_cache_poll();
+    if (game->pending_state == MAIN_MENU || game->current_state != MAIN_MENU) {
+        return;
+    }
+    if (dictionary_cache_state(game->current_language, NULL) != DICTIONARY_CACHE_LOADING) {
+        GameState mode = game->pending_state;
+        game->pending_state = MAIN_MENU;
+        enter_game_mode(game, mode);
+    }
+}
 
 void handle_events(Game* game) {
     SDL_Event event; // e un union din SDL care are mai multe evenimente si substructuri(evenimente generate de mouse, miscari, tastatura)
     while (SDL_PollEvent(&event)) {
+        // fiecare eveniment e aplicat la momentul lui: o tasta apasata dupa ce timpul a expirat gaseste jocul deja pierdut,
+        // chiar daca frame-urile dintre ele n-au apucat sa ruleze
+        update_simulation_to(game, event.common.timestamp);
         switch (event.type) {
             case SDL_QUIT:
                 cleanup_game(game);
                 exit(0);
                 break;
+            case SDL_RENDER_TARGETS_RESET: // continutul texturilor target s-a pierdut, straturile se redeseneaza
+                render_layer_invalidate(&game->board_layer);
+                render_layer_invalidate(&game->overlay_layer);
+                break;
+            case SDL_RENDER_DEVICE_RESET: // texturile nu mai exista deloc
+                render_layer_destroy(&game->board_layer);
+                render_layer_destroy(&game->overlay_layer);
+                break;
             case SDL_MOUSEBUTTONDOWN:
                 if (event.button.button == SDL_BUTTON_LEFT) { //cand se apasa clickul
                     if (game->current_state == MAIN_MENU) {
-                        int mouse_x = event.button.x;   //cand suntem in main menu se iau coordonatele de la apasarea clickului
-                        int mouse_y = event.button.y;
-
-                        for (int i = 0; i < BUTTON_COUNT; i++) {
-                            if (SDL_PointInRect(&(SDL_Point){mouse_x, mouse_y}, &game->buttons[i].rect)) {
-                                                            //se verfica daca clickul este in limitele dreptunghiului butonului
-                                normal_mode_cleanup(game); //functia cere 2 pointeri si returneaza un bool,SDL_Point variabila temp ce stocheaza coordonatele
+                        //cand suntem in main menu se cauta butonul de sub click in layout-ul tinut minte
+                        int i = button_group_hit_test(&game->menu_buttons, event.button.x, event.button.y);
+                        switch (i) { //pentru fiecare buton se initializeaza starea
+                            case BUTTON_NORMAL_MODE:
+                                request_game_mode(game, NORMAL_MODE);
+                                break;
+                            case BUTTON_HARD_MODE:
+                                request_game_mode(game, HARD_MODE);
+                                break;
+                            case BUTTON_VERSUS_MODE:
+                                request_game_mode(game, VERSUS_MODE);
+                                break;
+                            case BUTTON_EVIL_MODE:
+                                request_game_mode(game, EVIL_MODE);
+                                break;
+                            case BUTTON_LANGUAGE:
+                                game->current_language = (game->current_language == LANG_ENGLISH) ? LANG_ROMANIAN : LANG_ENGLISH;
+                                normal_mode_cleanup(game); 
                                 hard_mode_cleanup(game);   
                                 versus_mode_cleanup(game);
-                                switch (i) { //pentru fiecare buton se initializeaza starea
-                                    case BUTTON_NORMAL_MODE:
-                                        game->current_state = NORMAL_MODE;
-                                        normal_mode_init(game); 
-                                        break;
-                                    case BUTTON_HARD_MODE:
-                                        game->current_state = HARD_MODE;
-                                        hard_mode_init(game); 
-                                        break;
-                                    case BUTTON_VERSUS_MODE:
-                                        game->current_state = VERSUS_MODE;
-                                        versus_mode_init(game);
-                                        break;
-                                    case BUTTON_LANGUAGE:
-                                        game->current_language = (game->current_language == LANG_ENGLISH) ? LANG_ROMANIAN : LANG_ENGLISH;
-                                        normal_mode_cleanup(game); 
-                                        hard_mode_cleanup(game);   
-                                        versus_mode_cleanup(game);
-
-                                }
-                                if ((game->current_state == NORMAL_MODE || game->current_state == HARD_MODE || 
-                                game->current_state == VERSUS_MODE) && game->hangman == NULL && game->versus_data == NULL) {
-                                    fprintf(stderr, "Error at initialing game mode.\n");
-                                    game->current_state = MAIN_MENU; // daca da fail sa se initializeze un mod de joc
-                                }
+                                evil_mode_cleanup(game);
+                                // noua limba incepe sa se incarce in fundal cat timp utilizatorul e inca in meniu
+                                dictionary_cache_prefetch(game->current_language);
                                 break;
-                            }
+                            default:
+                                break; // click in afara butoanelor
                         }
                     } else if (game->current_state == NORMAL_MODE) {
                         normal_mode_handle_event(game, &event);
@@ -318,38 +341,24 @@ void handle_events(Game* game) {
                         hard_mode_handle_event(game, &event);
                     }else if (game->current_state == VERSUS_MODE) { 
                         versus_mode_handle_event(game, &event);
+                    } else if (game->current_state == EVIL_MODE) {
+                        evil_mode_handle_event(game, &event);
                     }
                 }
                 break;
 
             case SDL_MOUSEMOTION: // pentru efectele de hover din main menu
                 if (game->current_state == MAIN_MENU) {
-                    int mouse_x = event.motion.x;
-                    int mouse_y = event.motion.y;
-                    for (int i = 0; i < BUTTON_COUNT; i++) { //se verifica daca clickul e in coord lui rect
-                        bool is_hovered_now = SDL_PointInRect(&(SDL_Point){mouse_x, mouse_y}, &game->buttons[i].rect);
-                        if (game->buttons[i].is_hovered != is_hovered_now) {
-                            game->buttons[i].is_hovered = is_hovered_now;
-                            // se reface culoarea cand mouse-ul e hovered sau nu
-                            SDL_Color current_color = {255, 255, 255, 255}; // alb
-                            if (game->buttons[i].is_hovered) {
-                                current_color = (SDL_Color){69,192,215,255}; // albastru la hover
-                            }
-                            if (game->buttons[i].texture) {
-                                SDL_DestroyTexture(game->buttons[i].texture); //se distruge textura anterioara si se creeaza una noua
-                            }
-                            SDL_Surface* text_surface = TTF_RenderText_Blended(game->text_font, game->buttons[i].text, current_color);
-                            if (text_surface) {
-                                game->buttons[i].texture = SDL_CreateTextureFromSurface(game->renderer, text_surface);
-                                SDL_FreeSurface(text_surface);
-                            }
-                        }
-                    }
+                    // texturile de hover sunt deja facute, se schimba doar starea butoanelor
+                    button_group_set_hover(&game->menu_buttons, event.motion.x, event.motion.y);
                 }
                 break;
 
             case SDL_KEYDOWN:
-                if (event.key.keysym.scancode == SDL_SCANCODE_ESCAPE) {
+                if (event.key.keysym.scancode == SDL_SCANCODE_F3) {
+                    perf_overlay_toggle(); // overlay-ul de timpi, in orice ecran
+                }
+                else if (event.key.keysym.scancode == SDL_SCANCODE_ESCAPE) {
                     if (game->current_state != MAIN_MENU) {
                         // iese din fiecare game mode si da clean
                         if (game->current_state == NORMAL_MODE) {
@@ -358,8 +367,13 @@ void handle_events(Game* game) {
                             hard_mode_cleanup(game);
                         } else if (game->current_state == VERSUS_MODE){
                             //versus_mode_cleanup(game);
+                            versus_bot_cancel(game->versus_bot); // jocul ramane, dar botul nu mai gandeste in meniu
+                        } else if (game->current_state == EVIL_MODE) {
+                            evil_mode_cleanup(game);
                         }
                         game->current_state = MAIN_MENU; //se updateaza state-ul
+                    } else if (game->pending_state != MAIN_MENU) {
+                        game->pending_state = MAIN_MENU; // renunta la modul care astepta dictionarul
                     } else {
                         cleanup_game(game); // daca e in main menu se da clean si iese
                         exit(0);
@@ -374,22 +388,92 @@ void handle_events(Game* game) {
                 else if (game->current_state == VERSUS_MODE) { 
                     versus_mode_handle_event(game, &event);
                 }
+                else if (game->current_state == EVIL_MODE) {
+                    evil_mode_handle_event(game, &event);
+                }
+                break;
+
+            default:
+                // doar mutarea botului (eveniment SDL inregistrat); KEYUP, TEXTINPUT, WINDOWEVENT etc. nu ajung in mod
+                if (game->current_state == VERSUS_MODE && game->versus_bot && event.type == game->versus_bot->event_type) {
+                    versus_mode_handle_event(game, &event);
+                }
                 break;
         }
     }
 }
 
+// un pas fix al simularii: timerele, time-out-ul si pauzele dintre runde ale modului curent
+static void update_step(Game* game) {
+    game->sim_time_ms += UPDATE_STEP_MS;
+    if (game->current_state == HARD_MODE && game->hangman) {
+        rules_hard_tick(game->hangman, &game->rules_env);
+    } else if (game->current_state == VERSUS_MODE && game->versus_data) {
+        rules_versus_tick(game->versus_data, &game->rules_env);
+        versus_mode_update(game); // pauza dintre runde expira si fara input
+    }
+}
+
+// Consuma timpul real pana la ticks in pasi de UPDATE_STEP_MS; restul ramane pentru update-ul urmator.
+// Nu exista limita de pasi: un pas costa cateva comparatii, iar timpul nu se pierde (ex. fereastra minimizata).
+void update_simulation_to(Game* game, Uint32 ticks) {
+    if ((Sint32)(ticks - game->sim_last_ticks) <= 0) {
+        return; // timestamp-ul unui eveniment mai vechi decat ultimul update
+    }
+    game->sim_accumulator_ms += (long)(ticks - game->sim_last_ticks);
+    game->sim_last_ticks = ticks;
+    while (game->sim_accumulator_ms >= UPDATE_STEP_MS) {
+        update_step(game);
+        game->sim_accumulator_ms -= UPDATE_STEP_MS;
+    }
+    game->sim_alpha = (float)game->sim_accumulator_ms / UPDATE_STEP_MS;
+}
+
+// tot ce nu tine de un eveniment anume: simularea, dictionarele incarcate in fundal si modul care le astepta
+void update_game(Game* game) {
+    update_simulation_to(game, SDL_GetTicks());
+    update_pending_game_mode(game);
+}
+
+// timpul ramas asa cum il arata render-ul: intre doi pasi, un timer care curge e extrapolat cu fractiunea de pas
+long interpolated_time_left(const Game* game, const HangmanGame* hangman, bool running) {
+    long time_left = hangman->time_left_ms;
+    if (running) {
+        time_left -= (long)(game->sim_alpha * UPDATE_STEP_MS);
+    }
+    return time_left > 0 ? time_left : 0;
+}
+
+// true cat timp ecranul se schimba si fara input: bara de progres, timerele din hard/versus, pauza dupa un cuvant ghicit,
+// pauza dintre rundele versus si blocarea inputului dupa final, overlay-ul de timpi. Altfel bucla principala doarme
+// pana la urmatorul eveniment, iar tranzitiile cu timp n-ar mai avea cine sa le porneasca.
+bool game_is_animating(const Game* game) {
+    if (perf_overlay_visible()) {
+        return true;
+    }
+    switch (game->current_state) {
+        case MAIN_MENU:
+            return game->pending_state != MAIN_MENU ||
+                   dictionary_cache_state(game->current_language, NULL) == DICTIONARY_CACHE_LOADING;
+        case HARD_MODE:
+            return game->hangman != NULL && !game->hangman->game_over; // include pauza dupa un cuvant ghicit (win)
+        case VERSUS_MODE:
+            if (game->versus_data == NULL) {
+                return false;
+            }
+            if (rules_versus_game_over(game->versus_data)) {
+                return game->sim_time_ms - game->versus_data->round_over_display_time < VERSUS_GAME_OVER_DISPLAY_MS;
+            }
+            return true; // runda in joc sau pauza pana la runda urmatoare
+        default:
+            return false; // normal mode nu are timere
+    }
+}
+
 void render_main_menu(Game* game) {
     SDL_RenderCopy(game->renderer, game->background, NULL, NULL);
     
-    for (int i = 0; i < BUTTON_COUNT; i++) {
-       
-        if (game->buttons[i].texture) {
-            SDL_RenderCopy(game->renderer, game->buttons[i].texture, NULL, &game->buttons[i].rect); //afiseaza fiecare buton pe ecran
-        } else {
-            fprintf(stderr, "Error in main menu for button texture for '%s'\n", game->buttons[i].text);
-        }
-    }
+    button_group_render(game->renderer, &game->menu_buttons); //afiseaza fiecare buton pe ecran
     SDL_Texture* current_flag_texture = NULL;
     if (game->current_language == LANG_ENGLISH) {
         current_flag_texture = game->flag_en_texture;
@@ -400,9 +484,20 @@ void render_main_menu(Game* game) {
     if (current_flag_texture) {
         SDL_RenderCopy(game->renderer, current_flag_texture, NULL, &game->flag_rect);
     } else {
-        fprintf(stderr, "WARNING: No flag texture to render for language %d.\n", game->current_language);
+        LOG_WARN(LOG_CAT_GAME, "No flag texture to render for language %d.", game->current_language);
     }
 
+    // bara de progres cat timp dictionarul limbii curente se incarca in fundal
+    int progress = 0;
+    if (dictionary_cache_state(game->current_language, &progress) == DICTIONARY_CACHE_LOADING) {
+        SDL_Rect bar_rect = {WIDTH / 2 - 150, 460, 300, 16};
+        SDL_Rect fill_rect = bar_rect;
+        fill_rect.w = bar_rect.w * progress / 1000;
+        SDL_SetRenderDrawColor(game->renderer, 69, 192, 215, 255); // acelasi albastru ca la hover
+        SDL_RenderFillRect(game->renderer, &fill_rect);
+        SDL_SetRenderDrawColor(game->renderer, 255, 255, 255, 255);
+        SDL_RenderDrawRect(game->renderer, &bar_rect);
+    }
 }
 
 void render_mode_under_construction(Game* game) {
@@ -413,29 +508,52 @@ void render_mode_under_construction(Game* game) {
     render_text(game->renderer, game->text_font, "Mode Under Construction", white,
                 (WIDTH - (strlen("Mode Under Construction") * FONT_SIZE / 2)) / 2, (HEIGHT - FONT_SIZE) / 2);
 }
+KeyState keyboard_key_state(const HangmanGame* hangman, int letter) {
+    if (!hangman->guessed_letters[letter]) {
+        return KEY_STATE_NORMAL;
+    }
+    return ((hangman->word_letter_mask >> letter) & 1u) ? KEY_STATE_GUESSED : KEY_STATE_WRONG;
+}
+
+// Litera e copiata din atlas, centrata in tasta; culoarea e doar color mod, nu alta textura.
+void render_letter_key(Game* game, int letter, SDL_Color color) {
+    if (game->letter_atlas == NULL || game->letter_atlas->texture == NULL || letter < 0 || letter >= ALPHABET_SIZE) {
+        return;
+    }
+    SDL_Texture* texture = game->letter_atlas->texture;
+    const TextGlyph* glyph = &game->letter_atlas->glyphs['A' + letter - TEXT_ATLAS_FIRST_CHAR];
+    SDL_Rect key_rect = game->letter_rects[letter];
+    SDL_Rect text_dst_rect = {
+        key_rect.x + (key_rect.w - glyph->src.w) / 2,
+        key_rect.y + (key_rect.h - glyph->src.h) / 2,
+        glyph->src.w,
+        glyph->src.h
+    };
+    SDL_SetTextureColorMod(texture, color.r, color.g, color.b);
+    SDL_SetTextureAlphaMod(texture, color.a);
+    SDL_RenderCopy(game->renderer, texture, &glyph->src, &text_dst_rect);
+    SDL_SetTextureColorMod(texture, 255, 255, 255); // atlasul e folosit si de render_text
+    SDL_SetTextureAlphaMod(texture, 255);
+}
+
 void render_keyboard(Game* game) {
-    if (game == NULL || game->renderer == NULL || game->hangman == NULL || game->hangman->letter_textures[0] == NULL) {
-        fprintf(stderr, "ERROR: render_keyboard: Invalid game data or uninitialized letter textures.\n");
+    if (game == NULL || game->renderer == NULL || game->hangman == NULL || game->letter_atlas == NULL) {
+        LOG_ERROR(LOG_CAT_GAME, "render_keyboard: Invalid game data or uninitialized letter atlas.");
         return;
     }
 
     SDL_Color border_color = {255, 255, 255, 255};     
-
+    const SDL_Color key_colors[KEY_STATE_COUNT] = {
+        {255, 255, 255, 255}, // KEY_STATE_NORMAL
+        {0, 255, 0, 255},     // KEY_STATE_GUESSED
+        {255, 0, 0, 255}      // KEY_STATE_WRONG
+    };
+
+    SDL_SetRenderDrawColor(game->renderer, border_color.r, border_color.g, border_color.b, border_color.a);
+    SDL_RenderDrawRects(game->renderer, game->letter_rects, ALPHABET_SIZE);
+    const SDL_Color hint_color = {255, 255, 0, 255};
     for (int i = 0; i < ALPHABET_SIZE; i++) {
-        SDL_Rect key_rect = game->hangman->letter_rects[i];
-        SDL_SetRenderDrawColor(game->renderer, border_color.r, border_color.g, border_color.b, border_color.a);
-        SDL_RenderDrawRect(game->renderer, &key_rect);
-
-        if (game->hangman->letter_textures[i]) {
-            int text_width, text_height;
-            SDL_QueryTexture(game->hangman->letter_textures[i], NULL, NULL, &text_width, &text_height);
-            SDL_Rect text_dst_rect = {
-                key_rect.x + (key_rect.w - text_width) / 2,
-                key_rect.y + (key_rect.h - text_height) / 2,
-                text_width,
-                text_height
-            };
-            SDL_RenderCopy(game->renderer, game->hangman->letter_textures[i], NULL, &text_dst_rect);
-        }
+        SDL_Color color = game->hint_letter == 'A' + i ? hint_color : key_colors[keyboard_key_state(game->hangman, i)];
+        render_letter_key(game, i, color);
     }
-}
\ No newline at end of file
+}
@@ -5,10 +5,27 @@
 #include <SDL2/SDL_image.h>
 #include <SDL2/SDL_ttf.h>
 #include <stdbool.h>
+#include "widget.h"
+#include "render_layer.h"
+#include "text_atlas.h"
+#include "rules.h"
+#include "hint.h"
+#include "evil.h"
+#include "versus_bot.h"
 
 #define WIDTH 1000
 #define HEIGHT 800
 #define FONT_SIZE 40 
+#define KEYBOARD_ROWS 2
+#define KEYBOARD_COLS 13
+#define KEY_WIDTH 40
+#define KEY_HEIGHT 40
+#define KEY_SPACING 10
+#define KEYBOARD_START_X 180
+#define KEYBOARD_START_Y 650
+#define UPDATE_STEP_MS 10   // pasul fix al simularii (timere, time-out, pauze)
+#define HINT_SCANCODE SDL_SCANCODE_F1   // sugestia de litera in normal si hard mode
+#define VERSUS_BOT_SCANCODE SDL_SCANCODE_F2 // in versus: Player 2 om -> CPU easy -> medium -> hard -> om
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
 #endif
@@ -24,25 +41,26 @@ typedef enum {
     NORMAL_MODE,
     HARD_MODE, 
     VERSUS_MODE,
+    EVIL_MODE,
 } GameState;
 
-typedef struct Button {
-    SDL_Rect rect; 
-    SDL_Texture* texture; 
-    char text[50]; 
-    bool is_hovered;
-} Button; 
 
 typedef enum {
     BUTTON_NORMAL_MODE,
     BUTTON_HARD_MODE,
     BUTTON_VERSUS_MODE,
+    BUTTON_EVIL_MODE,
     BUTTON_LANGUAGE,
     BUTTON_COUNT
 } ButtonType;
 
-typedef struct HangmanGame HangmanGame; 
-typedef struct VersusHangman VersusHangman;
+// starea unei taste de pe tastatura; se vede doar prin culoarea literei (color mod pe atlas)
+typedef enum {
+    KEY_STATE_NORMAL,
+    KEY_STATE_GUESSED,   // litera ghicita, e in cuvant
+    KEY_STATE_WRONG,     // litera incercata, nu e in cuvant
+    KEY_STATE_COUNT
+} KeyState;
 
 typedef struct Game {
     SDL_Window* window;
@@ -51,34 +69,65 @@ typedef struct Game {
     TTF_Font* text_font;
     SDL_Color text_color;
     GameState current_state;
+    GameState pending_state; // mod ales din meniu care asteapta dictionarul (MAIN_MENU = niciunul)
     Button buttons[BUTTON_COUNT];
+    ButtonGroup menu_buttons; // layout + hover pentru buttons[]
     HangmanGame* hangman; 
     VersusHangman* versus_data;
+    VersusBot* versus_bot;   // firul care joaca PLAYER_2; NULL cand Player 2 e om
+    VersusBotStrength versus_bot_strength; // ramane aleasa intre jocuri
+    EvilGame* evil_data;     // candidatii din evil mode; hangman tine reprezentantul lor
+    ParallelPool* workers;   // pornit la prima intrare in evil mode, oprit in cleanup_game
+    HintState hint;          // candidatii pentru hint in normal/hard mode, filtrati la fiecare tasta
+    char hint_letter;        // litera sugerata, evidentiata pe tastatura pana la urmatoarea tasta; '\0' = niciuna
+    RulesEnv rules_env;      // ceasul simularii (sim_time_ms) si RNG-ul cu care modurile apeleaza rules.c
+
+    // simularea merge in pasi fixi de UPDATE_STEP_MS, independent de frame rate; render-ul doar citeste
+    long sim_time_ms;        // ceasul regulilor: timerele, pauzele dintre runde, momentul fiecarei litere
+    Uint32 sim_last_ticks;   // pana unde (SDL_GetTicks) a fost consumat timpul real
+    long sim_accumulator_ms; // timp real inca neconsumat, < UPDATE_STEP_MS dupa fiecare update
+    float sim_alpha;         // sim_accumulator_ms / UPDATE_STEP_MS, pentru interpolarea timerelor in render
     char temp_message[256];
 
     GameLanguage current_language; 
     SDL_Texture* flag_en_texture;  
     SDL_Texture* flag_ro_texture;  
     SDL_Rect flag_rect;            
+
+    // straturi cache-uite de modurile de joc; cheia include modul, deci se refac la schimbarea modului
+    RenderLayer board_layer;       // tot ce se schimba doar la o tasta apasata
+    RenderLayer overlay_layer;     // mesajele de final de runda/joc, peste timere
+
+    // tastatura comuna tuturor modurilor (si ambilor jucatori din versus), facuta o data in load_media:
+    // literele vin din atlasul fontului text_font, acelasi folosit de render_text
+    TextAtlas* letter_atlas;
+    SDL_Rect letter_rects[ALPHABET_SIZE];
 } Game;
 
 bool initialize_game(Game* game);
 void cleanup_game(Game* game);
 bool load_media(Game* game);
 void handle_events(Game* game);
+void update_game(Game* game);
+void update_simulation_to(Game* game, Uint32 ticks);
+long interpolated_time_left(const Game* game, const HangmanGame* hangman, bool running);
+bool game_is_animating(const Game* game);
 void render_main_menu(Game* game);
 //void render_mode_under_construction(Game* game); 
 void render_text(SDL_Renderer* renderer, TTF_Font* font, const char* text, SDL_Color color, int x, int y);
 void render_hangman_image(SDL_Renderer* renderer, int wrong_guesses, int x_offset, int y_offset, bool mirrored);
 void render_keyboard(Game* game); 
+void render_letter_key(Game* game, int letter, SDL_Color color);
+KeyState keyboard_key_state(const HangmanGame* hangman, int letter);
 
 void versus_mode_init(Game* game);
 void versus_mode_cleanup(Game* game);
 void versus_mode_reset(Game* game, bool full_game_reset);
 void versus_mode_handle_event(Game* game, SDL_Event* event);
 void versus_mode_render(Game* game);
+void versus_mode_update(Game* game);
+void versus_mode_set_bot(Game* game, VersusBotStrength strength);
 
 void versus_mode_process_key(Game* game, char key);
-void versus_mode_update_displayed_word(HangmanGame* hangman);
 
 #endif // __INTERFACE__
\ No newline at end of file
@@ -0,0 +1,228 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <strings.h>
+#include <pthread.h>
+#include <time.h>
+
+#include "log.h"
+
+#define LOG_RING_MASK (LOG_RING_SIZE - 1)
+
+// Un slot al ring-ului. sequence spune cine il poate folosi (coada MPMC marginita a lui Vyukov):
+// == pozitia de scriere -> liber pentru producatorul care a rezervat pozitia,
+// == pozitia + 1 -> mesaj complet, il poate citi firul din fundal.
+typedef struct LogRecord {
+    atomic_size_t sequence;
+    double time_s;          // secunde de la log_init
+    LogLevel level;
+    LogCategory category;
+    char message[LOG_MESSAGE_SIZE];
+} LogRecord;
+
+static const char* log_level_names[LOG_LEVEL_COUNT] = {"DEBUG", "INFO", "WARN", "ERROR"};
+static const char* log_category_names[LOG_CAT_COUNT] = {"game", "normal", "hard", "versus", "evil", "rules", "dict", "render"};
+
+static struct {
+    LogRecord ring[LOG_RING_SIZE];
+    atomic_size_t head;        // urmatoarea pozitie rezervata de producatori
+    size_t tail;               // urmatoarea pozitie citita; doar firul din fundal
+    atomic_bool running;       // ring-ul + firul sunt pornite
+    atomic_bool stop;
+    atomic_uint dropped;       // mesaje pierdute pentru ca ring-ul era plin
+    atomic_int level;          // nivelul minim la runtime
+    pthread_t thread;
+    struct timespec start;
+
+    // folosite doar de firul din fundal
+    FILE* file;
+    char path[256];
+    long file_size;
+} log_state = {.level = LOG_COMPILE_LEVEL};
+
+static double log_elapsed_seconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)(now.tv_sec - log_state.start.tv_sec) + (double)(now.tv_nsec - log_state.start.tv_nsec) / 1e9;
+}
+
+// .log.(KEEP-1) -> .log.KEEP, ..., .log -> .log.1, apoi un .log nou
+static void log_rotate(void) {
+    char from[sizeof(log_state.path) + 8];
+    char to[sizeof(log_state.path) + 8];
+    fclose(log_state.file);
+    for (int i = LOG_FILE_KEEP - 1; i >= 1; i--) {
+        snprintf(from, sizeof(from), "%s.%d", log_state.path, i);
+        snprintf(to, sizeof(to), "%s.%d", log_state.path, i + 1);
+        rename(from, to);
+    }
+    snprintf(to, sizeof(to), "%s.1", log_state.path);
+    rename(log_state.path, to);
+    log_state.file = fopen(log_state.path, "w");
+    log_state.file_size = 0;
+}
+
+static void log_emit(const LogRecord* record) {
+    if (record->level >= LOG_LEVEL_WARN) {
+        fprintf(stderr, "%s: %s\n", log_level_names[record->level], record->message);
+    }
+    if (!log_state.file) {
+        return;
+    }
+    int written = fprintf(log_state.file, "%10.3f %-5s %-6s %s\n", record->time_s,
+                          log_level_names[record->level], log_category_names[record->category], record->message);
+    if (written > 0) {
+        log_state.file_size += written;
+    }
+    if (log_state.file_size >= LOG_FILE_MAX_BYTES) {
+        log_rotate();
+    }
+}
+
+// goleste tot ce e complet in ring; intoarce cate mesaje a scris
+static int log_drain(void) {
+    int drained = 0;
+    for (;;) {
+        LogRecord* record = &log_state.ring[log_state.tail & LOG_RING_MASK];
+        size_t sequence = atomic_load_explicit(&record->sequence, memory_order_acquire);
+        if (sequence != log_state.tail + 1) {
+            break; // gol, sau producatorul inca scrie in slot
+        }
+        log_emit(record);
+        atomic_store_explicit(&record->sequence, log_state.tail + LOG_RING_SIZE, memory_order_release);
+        log_state.tail++;
+        drained++;
+    }
+    unsigned int dropped = atomic_exchange_explicit(&log_state.dropped, 0, memory_order_relaxed);
+    if (dropped > 0 && log_state.file) {
+        fprintf(log_state.file, "%10.3f WARN  game   log: ring buffer full, %u messages dropped\n", log_elapsed_seconds(), dropped);
+    }
+    if (drained > 0 && log_state.file) {
+        fflush(log_state.file);
+    }
+    return drained;
+}
+
+static void* log_thread_main(void* arg) {
+    (void)arg;
+    struct timespec interval = {0, LOG_DRAIN_INTERVAL_MS * 1000000L};
+    while (!atomic_load_explicit(&log_state.stop, memory_order_acquire)) {
+        if (log_drain() == 0) {
+            nanosleep(&interval, NULL);
+        }
+    }
+    log_drain(); // ce a mai ramas dupa oprire
+    return NULL;
+}
+
+static LogLevel log_level_from_env(void) {
+    const char* env = getenv("HANGMAN_LOG_LEVEL");
+    if (env) {
+        for (int i = 0; i < LOG_LEVEL_COUNT; i++) {
+            if (strcasecmp(env, log_level_names[i]) == 0) {
+                return (LogLevel)i;
+            }
+        }
+    }
+    return LOG_COMPILE_LEVEL;
+}
+
+bool log_init(const char* path) {
+    if (atomic_load(&log_state.running)) {
+        return true;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &log_state.start);
+    atomic_store(&log_state.level, log_level_from_env());
+    for (size_t i = 0; i < LOG_RING_SIZE; i++) {
+        atomic_store_explicit(&log_state.ring[i].sequence, i, memory_order_relaxed);
+    }
+    atomic_store(&log_state.head, 0);
+    log_state.tail = 0;
+    atomic_store(&log_state.dropped, 0);
+    atomic_store(&log_state.stop, false);
+
+    snprintf(log_state.path, sizeof(log_state.path), "%s", path);
+    log_state.file = fopen(log_state.path, "a");
+    if (!log_state.file) {
+        fprintf(stderr, "WARNING: log_init: Cannot open %s, logging only warnings and errors to stderr.\n", path);
+    } else {
+        fseek(log_state.file, 0, SEEK_END);
+        log_state.file_size = ftell(log_state.file);
+        time_t wall = time(NULL);
+        fprintf(log_state.file, "---- log started %s", ctime(&wall));
+    }
+
+    if (pthread_create(&log_state.thread, NULL, log_thread_main, NULL) != 0) {
+        fprintf(stderr, "WARNING: log_init: Cannot start logger thread, logging synchronously to stderr.\n");
+        if (log_state.file) {
+            fclose(log_state.file);
+            log_state.file = NULL;
+        }
+        return false;
+    }
+    atomic_store_explicit(&log_state.running, true, memory_order_release);
+    return true;
+}
+
+void log_shutdown(void) {
+    if (!atomic_exchange(&log_state.running, false)) {
+        return;
+    }
+    atomic_store_explicit(&log_state.stop, true, memory_order_release);
+    pthread_join(log_state.thread, NULL);
+    if (log_state.file) {
+        fclose(log_state.file);
+        log_state.file = NULL;
+    }
+}
+
+void log_set_level(LogLevel level) {
+    atomic_store_explicit(&log_state.level, level, memory_order_relaxed);
+}
+
+void log_write(LogLevel level, LogCategory category, const char* format, ...) {
+    if ((int)level < atomic_load_explicit(&log_state.level, memory_order_relaxed)) {
+        return;
+    }
+    va_list args;
+    if (!atomic_load_explicit(&log_state.running, memory_order_acquire)) {
+        // fara fir de fundal (tool-uri, inainte de init): direct pe stderr
+        fprintf(stderr, "%s: ", log_level_names[level]);
+        va_start(args, format);
+        vfprintf(stderr, format, args);
+        va_end(args);
+        fputc('\n', stderr);
+        return;
+    }
+
+    // rezerva o pozitie; daca slotul ei inca n-a fost citit, ring-ul e plin si mesajul se pierde
+    size_t position = atomic_load_explicit(&log_state.head, memory_order_relaxed);
+    LogRecord* record;
+    for (;;) {
+        record = &log_state.ring[position & LOG_RING_MASK];
+        size_t sequence = atomic_load_explicit(&record->sequence, memory_order_acquire);
+        intptr_t diff = (intptr_t)sequence - (intptr_t)position;
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&log_state.head, &position, position + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            atomic_fetch_add_explicit(&log_state.dropped, 1, memory_order_relaxed);
+            return;
+        } else {
+            position = atomic_load_explicit(&log_state.head, memory_order_relaxed);
+        }
+    }
+
+    record->time_s = log_elapsed_seconds();
+    record->level = level;
+    record->category = category;
+    va_start(args, format);
+    vsnprintf(record->message, sizeof(record->message), format, args);
+    va_end(args);
+    atomic_store_explicit(&record->sequence, position + 1, memory_order_release);
+}
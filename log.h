@@ -0,0 +1,67 @@
+#ifndef __LOG__
+#define __LOG__
+
+#include <stdbool.h>
+
+// Jurnal cu niveluri si categorii, fara SDL (merge si in hangman_core / tool-urile headless).
+// Firul care logheaza doar formateaza mesajul intr-un slot al unui ring buffer lock-free;
+// un fir din fundal goleste ring-ul intr-un fisier rotit (si copiaza WARN/ERROR pe stderr).
+// Inainte de log_init si dupa log_shutdown mesajele merg direct pe stderr, sincron.
+
+#define LOG_FILE_PATH "hangman.log"
+#define LOG_FILE_MAX_BYTES (1024 * 1024)  // peste atat fisierul se roteste: .log -> .log.1 -> ... -> .log.LOG_FILE_KEEP
+#define LOG_FILE_KEEP 3
+#define LOG_RING_SIZE 1024                // putere a lui 2; cand e plin mesajele noi se pierd (si se numara), nu se asteapta
+#define LOG_MESSAGE_SIZE 192              // mesajele mai lungi sunt taiate
+#define LOG_DRAIN_INTERVAL_MS 20          // cat doarme firul din fundal cand ring-ul e gol
+
+typedef enum {
+    LOG_LEVEL_DEBUG,
+    LOG_LEVEL_INFO,
+    LOG_LEVEL_WARN,
+    LOG_LEVEL_ERROR,
+    LOG_LEVEL_COUNT
+} LogLevel;
+
+typedef enum {
+    LOG_CAT_GAME,     // interface.c, bucla principala
+    LOG_CAT_NORMAL,
+    LOG_CAT_HARD,
+    LOG_CAT_VERSUS,
+    LOG_CAT_EVIL,
+    LOG_CAT_RULES,
+    LOG_CAT_DICT,     // dictionar, cache-ul de dictionare, indexul pe lungimi
+    LOG_CAT_RENDER,   // atlas, straturi, widget-uri, overlay
+    LOG_CAT_COUNT
+} LogCategory;
+
+// Nivelul minim compilat: in build-urile release (NDEBUG) LOG_DEBUG dispare complet, cu tot cu argumente.
+// Se poate forta cu -DLOG_COMPILE_LEVEL=LOG_LEVEL_WARN etc.
+#ifndef LOG_COMPILE_LEVEL
+#ifdef NDEBUG
+#define LOG_COMPILE_LEVEL LOG_LEVEL_INFO
+#else
+#define LOG_COMPILE_LEVEL LOG_LEVEL_DEBUG
+#endif
+#endif
+
+// conditia e constanta, deci apelul e eliminat de compilator, dar formatul si argumentele sunt tot verificate
+#define LOG_AT(level, category, ...) \
+    do { if ((level) >= LOG_COMPILE_LEVEL) log_write((level), (category), __VA_ARGS__); } while (0)
+#define LOG_DEBUG(category, ...) LOG_AT(LOG_LEVEL_DEBUG, category, __VA_ARGS__)
+#define LOG_INFO(category, ...)  LOG_AT(LOG_LEVEL_INFO, category, __VA_ARGS__)
+#define LOG_WARN(category, ...)  LOG_AT(LOG_LEVEL_WARN, category, __VA_ARGS__)
+#define LOG_ERROR(category, ...) LOG_AT(LOG_LEVEL_ERROR, category, __VA_ARGS__)
+
+// path = fisierul jurnalului; nivelul de la runtime vine din HANGMAN_LOG_LEVEL (debug/info/warn/error)
+bool log_init(const char* path);
+void log_shutdown(void);   // goleste ring-ul, opreste firul, inchide fisierul; se poate apela de mai multe ori
+void log_set_level(LogLevel level);
+
+void log_write(LogLevel level, LogCategory category, const char* format, ...)
+#if defined(__GNUC__)
+    __attribute__((format(printf, 3, 4)))
+#endif
+    ;
+
+#endif // __LOG__
@@ -0,0 +1,161 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#include "opening_book.h"
+#include "log.h"
+
+// pozitiile unde litera e afisata pe tabla (0 = ratare)
+static uint32_t opening_book_positions(const HangmanGame* hangman, int letter) {
+    uint32_t positions = 0;
+    for (int p = 0; p < hangman->word_length; p++) {
+        if (hangman->displayed_word[2 * p] == 'A' + letter) {
+            positions |= 1u << p;
+        }
+    }
+    return positions;
+}
+
+static bool opening_book_nodes_ok(const OpeningBookNode* nodes, uint32_t node_count) {
+    for (uint32_t i = 1; i < node_count; i++) {
+        if (nodes[i].letter >= ALPHABET_SIZE ||
+            (nodes[i].child_count > 0 && (nodes[i].first_child <= i || (uint64_t)nodes[i].first_child + nodes[i].child_count > node_count))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool opening_book_load(OpeningBook* book, const Dictionary* dictionary, const char* filename) {
+    if (book == NULL || dictionary == NULL || filename == NULL) {
+        LOG_ERROR(LOG_CAT_DICT, "opening_book_load: Book, dictionary or filename is NULL.");
+        return false;
+    }
+    memset(book, 0, sizeof(OpeningBook));
+    FILE* file = fopen(filename, "rb");
+    if (!file) {
+        LOG_INFO(LOG_CAT_DICT, "opening_book_load: No %s, first hints are computed live.", filename);
+        return false;
+    }
+    OpeningBookFileHeader header;
+    bool ok = fread(&header, sizeof(header), 1, file) == 1 &&
+              memcmp(header.magic, OPENING_BOOK_FILE_MAGIC, sizeof(header.magic)) == 0 &&
+              header.version == OPENING_BOOK_FILE_VERSION &&
+              header.header_size == sizeof(OpeningBookFileHeader) &&
+              header.node_count >= 1 && header.node_count <= (1u << 24);
+    size_t size = ok ? sizeof(header) + (size_t)header.node_count * sizeof(OpeningBookNode) : 0;
+    unsigned char* data = ok ? (unsigned char*)malloc(size) : NULL;
+    if (data) {
+        memcpy(data, &header, sizeof(header));
+        ok = fread(data + sizeof(header), sizeof(OpeningBookNode), header.node_count, file) == header.node_count;
+    }
+    fclose(file);
+    if (!ok || data == NULL) {
+        LOG_ERROR(LOG_CAT_DICT, "opening_book_load: %s is not a valid version %d opening book.", filename, OPENING_BOOK_FILE_VERSION);
+        free(data);
+        return false;
+    }
+    const OpeningBookNode* nodes = (const OpeningBookNode*)(data + sizeof(header));
+    for (int len = 0; len <= WORD_INDEX_MAX_LENGTH; len++) {
+        ok = ok && header.roots[len] < header.node_count;
+    }
+    if (!ok || !opening_book_nodes_ok(nodes, header.node_count)) {
+        LOG_ERROR(LOG_CAT_DICT, "opening_book_load: %s has a broken tree.", filename);
+        free(data);
+        return false;
+    }
+    if (header.word_count != (uint32_t)dictionary->word_count || header.words_checksum != dictionary->words_checksum) {
+        LOG_WARN(LOG_CAT_DICT, "opening_book_load: %s was computed for another word list, ignoring it.", filename);
+        free(data);
+        return false;
+    }
+    book->data = data;
+    book->header = (const OpeningBookFileHeader*)data;
+    book->nodes = nodes;
+    LOG_INFO(LOG_CAT_DICT, "opening_book_load: %s, %u nodes, depth %u.", filename, header.node_count, header.depth);
+    return true;
+}
+
+void opening_book_free(OpeningBook* book) {
+    if (book == NULL) {
+        return;
+    }
+    free(book->data);
+    memset(book, 0, sizeof(OpeningBook));
+}
+
+bool opening_book_write(const Dictionary* dictionary, const OpeningBookNode* nodes, int node_count,
+                        const uint32_t* roots, int depth, const char* filename) {
+    if (dictionary == NULL || nodes == NULL || roots == NULL || filename == NULL || node_count < 1) {
+        LOG_ERROR(LOG_CAT_DICT, "opening_book_write: Nothing to write.");
+        return false;
+    }
+    OpeningBookFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, OPENING_BOOK_FILE_MAGIC, sizeof(header.magic));
+    header.version = OPENING_BOOK_FILE_VERSION;
+    header.header_size = sizeof(OpeningBookFileHeader);
+    header.word_count = (uint32_t)dictionary->word_count;
+    header.words_checksum = dictionary->words_checksum;
+    header.depth = (uint32_t)depth;
+    header.node_count = (uint32_t)node_count;
+    memcpy(header.roots, roots, sizeof(header.roots));
+
+    FILE* file = fopen(filename, "wb");
+    if (!file) {
+        LOG_ERROR(LOG_CAT_DICT, "opening_book_write: Cannot create %s: %s", filename, strerror(errno));
+        return false;
+    }
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+              fwrite(nodes, sizeof(OpeningBookNode), (size_t)node_count, file) == (size_t)node_count;
+    ok = (fclose(file) == 0) && ok;
+    if (!ok) {
+        LOG_ERROR(LOG_CAT_DICT, "opening_book_write: Failed to write %s.", filename);
+    }
+    return ok;
+}
+
+// copilul cu rezultatul dat, cautare binara (copiii sunt sortati dupa positions); 0 daca nu exista
+static uint32_t opening_book_child(const OpeningBook* book, const OpeningBookNode* node, uint32_t positions) {
+    int low = 0;
+    int high = node->child_count - 1;
+    while (low <= high) {
+        int middle = (low + high) / 2;
+        uint32_t child = node->first_child + (uint32_t)middle;
+        if (book->nodes[child].positions == positions) {
+            return child;
+        }
+        if (book->nodes[child].positions < positions) {
+            low = middle + 1;
+        } else {
+            high = middle - 1;
+        }
+    }
+    return 0;
+}
+
+int opening_book_letter(const OpeningBook* book, const HangmanGame* hangman, int* candidates) {
+    if (book == NULL || book->nodes == NULL || hangman == NULL ||
+        hangman->word_length < 1 || hangman->word_length > WORD_INDEX_MAX_LENGTH) {
+        return -1;
+    }
+    uint32_t node = book->header->roots[hangman->word_length];
+    uint32_t path_mask = 0;
+    for (uint32_t step = 0; node != 0 && step < book->header->depth; step++) {
+        int letter = book->nodes[node].letter;
+        if (!(hangman->guessed_mask & (1u << letter))) {
+            // cartea raspunde doar daca tabla contine exact literele de pe drum
+            if (hangman->guessed_mask != path_mask) {
+                return -1;
+            }
+            if (candidates) {
+                *candidates = (int)book->nodes[node].candidates;
+            }
+            return letter;
+        }
+        path_mask |= 1u << letter;
+        node = opening_book_child(book, &book->nodes[node], opening_book_positions(hangman, letter));
+    }
+    return -1;
+}
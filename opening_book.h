@@ -0,0 +1,56 @@
+#ifndef __OPENING_BOOK__
+#define __OPENING_BOOK__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "rules.h"
+
+#define OPENING_BOOK_FILE_MAGIC "HGMBOOK"   // 8 octeti cu '\0'
+#define OPENING_BOOK_FILE_VERSION 1
+#define OPENING_BOOK_MAX_DEPTH 4
+
+// Cartea de deschideri (tools/opening_book.c): pentru fiecare lungime, primele litere recomandate ca arbore
+// de decizie. Un nod spune litera de incercat; copiii lui sunt rezultatele posibile ale literei (pozitiile
+// unde apare, 0 = ratare), sortati dupa positions. Rezultatele cu prea putini candidati nu au nod:
+// acolo hint-ul live e oricum ieftin. Decizia depinde doar de tabla (literele incercate si unde au aparut),
+// nu de ordinea lor, asa ca acelasi nod raspunde si cand jucatorul a ajuns la tabla pe alta cale.
+//
+// Fisier: [header][OpeningBookNode nodes[node_count]]; nodul 0 nu e folosit (0 = "nicio radacina").
+
+typedef struct OpeningBookNode {
+    uint32_t positions;     // rezultatul literei parintelui care duce aici
+    uint32_t first_child;   // copiii sunt nodes[first_child .. first_child + child_count)
+    uint32_t candidates;    // cuvintele inca posibile la nodul asta
+    uint8_t letter;         // 0..25
+    uint8_t child_count;    // cel mult 255 de rezultate pastrate (cele mai mari)
+    uint16_t reserved;
+} OpeningBookNode;
+
+typedef struct OpeningBookFileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t header_size;
+    uint32_t word_count;       // ale dictionarului pentru care a fost calculata
+    uint32_t words_checksum;   // dictionary_words_checksum
+    uint32_t depth;            // cate litere are cel mai lung drum
+    uint32_t node_count;
+    uint32_t roots[WORD_INDEX_MAX_LENGTH + 1];   // nodul radacina pe lungime, 0 = lungimea nu e in carte
+} OpeningBookFileHeader;
+
+typedef struct OpeningBook {
+    unsigned char* data;                   // tot fisierul (e mic)
+    const OpeningBookFileHeader* header;
+    const OpeningBookNode* nodes;
+} OpeningBook;
+
+// false daca fisierul lipseste, e stricat sau e pentru alta lista de cuvinte (hint-urile raman live)
+bool opening_book_load(OpeningBook* book, const Dictionary* dictionary, const char* filename);
+void opening_book_free(OpeningBook* book);
+bool opening_book_write(const Dictionary* dictionary, const OpeningBookNode* nodes, int node_count,
+                        const uint32_t* roots, int depth, const char* filename);
+// 0..25 daca tabla lui hangman e in carte, altfel -1. Nu se uita la cuvantul secret.
+// candidates (optional) primeste cati candidati are tabla, ca la HintState.candidate_count.
+int opening_book_letter(const OpeningBook* book, const HangmanGame* hangman, int* candidates);
+
+#endif // __OPENING_BOOK__
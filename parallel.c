@@ -0,0 +1,255 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "parallel.h"
+#include "log.h"
+
+// Sirul de chunk-uri al unui fir, [begin, end) impachetat intr-un singur cuvant ca proprietarul
+// (care ia din fata) si hotii (care iau din spate) sa se poata sincroniza cu un singur CAS.
+typedef struct ParallelWorker {
+    _Alignas(64) _Atomic uint64_t range;   // begin << 32 | end
+} ParallelWorker;
+
+struct ParallelPool {
+    int size;                  // fire care lucreaza, cu tot cu apelantul
+    pthread_t* threads;        // size - 1 fire din fundal
+    ParallelWorker* workers;
+    pthread_mutex_t mutex;
+    pthread_cond_t wake;       // job nou sau oprire
+    pthread_cond_t done;       // ultimul fir a terminat jobul
+    unsigned int generation;   // creste la fiecare job
+    bool stop;
+    int active;                // fire inca in jobul curent (sub mutex)
+
+    // jobul curent, scris de apelant inainte de generation++
+    ParallelTask task;
+    void* context;
+    int count;
+    int grain;
+};
+
+typedef struct ParallelThreadArgs {
+    ParallelPool* pool;
+    int worker;
+} ParallelThreadArgs;
+
+static inline uint64_t parallel_pack(uint32_t begin, uint32_t end) {
+    return ((uint64_t)begin << 32) | end;
+}
+
+static void parallel_run_chunk(ParallelPool* pool, uint32_t chunk, int worker) {
+    int begin = (int)chunk * pool->grain;
+    int end = begin + pool->grain;
+    if (end > pool->count) {
+        end = pool->count;
+    }
+    pool->task(pool->context, begin, end, worker);
+}
+
+// primul chunk din fata propriului sir; false daca sirul e gol
+static bool parallel_pop(ParallelWorker* self, uint32_t* chunk) {
+    uint64_t range = atomic_load_explicit(&self->range, memory_order_acquire);
+    for (;;) {
+        uint32_t begin = (uint32_t)(range >> 32);
+        uint32_t end = (uint32_t)range;
+        if (begin >= end) {
+            return false;
+        }
+        if (atomic_compare_exchange_weak_explicit(&self->range, &range, parallel_pack(begin + 1, end),
+                                                  memory_order_acq_rel, memory_order_acquire)) {
+            *chunk = begin;
+            return true;
+        }
+    }
+}
+
+// jumatatea din spate a sirului victimei devine sirul hotului
+static bool parallel_steal(ParallelWorker* victim, ParallelWorker* self) {
+    uint64_t range = atomic_load_explicit(&victim->range, memory_order_acquire);
+    for (;;) {
+        uint32_t begin = (uint32_t)(range >> 32);
+        uint32_t end = (uint32_t)range;
+        if (begin >= end) {
+            return false;
+        }
+        uint32_t middle = end - (end - begin + 1) / 2;
+        if (atomic_compare_exchange_weak_explicit(&victim->range, &range, parallel_pack(begin, middle),
+                                                  memory_order_acq_rel, memory_order_acquire)) {
+            atomic_store_explicit(&self->range, parallel_pack(middle, end), memory_order_release);
+            return true;
+        }
+    }
+}
+
+static void parallel_work(ParallelPool* pool, int worker) {
+    ParallelWorker* self = &pool->workers[worker];
+    uint32_t chunk;
+    for (;;) {
+        while (parallel_pop(self, &chunk)) {
+            parallel_run_chunk(pool, chunk, worker);
+        }
+        bool stolen = false;
+        for (int i = 1; i < pool->size && !stolen; i++) {
+            stolen = parallel_steal(&pool->workers[(worker + i) % pool->size], self);
+        }
+        if (!stolen) {
+            return; // toate sirurile goale: ce a ramas e deja in lucru la alte fire
+        }
+    }
+}
+
+static void parallel_finish(ParallelPool* pool) {
+    pthread_mutex_lock(&pool->mutex);
+    if (--pool->active == 0) {
+        pthread_cond_signal(&pool->done);
+    }
+    pthread_mutex_unlock(&pool->mutex);
+}
+
+static void* parallel_thread_main(void* arg) {
+    ParallelThreadArgs args = *(ParallelThreadArgs*)arg;
+    free(arg);
+    ParallelPool* pool = args.pool;
+    unsigned int seen = 0;
+    for (;;) {
+        pthread_mutex_lock(&pool->mutex);
+        while (!pool->stop && pool->generation == seen) {
+            pthread_cond_wait(&pool->wake, &pool->mutex);
+        }
+        if (pool->stop) {
+            pthread_mutex_unlock(&pool->mutex);
+            return NULL;
+        }
+        seen = pool->generation;
+        pthread_mutex_unlock(&pool->mutex);
+
+        parallel_work(pool, args.worker);
+        parallel_finish(pool);
+    }
+}
+
+int parallel_cpu_count(void) {
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    if (count < 1) {
+        return 1;
+    }
+    return count > PARALLEL_MAX_THREADS ? PARALLEL_MAX_THREADS : (int)count;
+}
+
+ParallelPool* parallel_pool_create(int threads) {
+    if (threads <= 0) {
+        threads = parallel_cpu_count();
+    }
+    if (threads > PARALLEL_MAX_THREADS) {
+        threads = PARALLEL_MAX_THREADS;
+    }
+    ParallelPool* pool = (ParallelPool*)calloc(1, sizeof(ParallelPool));
+    if (!pool) {
+        LOG_ERROR(LOG_CAT_GAME, "parallel_pool_create: Failed to allocate the pool.");
+        return NULL;
+    }
+    pool->workers = (ParallelWorker*)aligned_alloc(64, (size_t)threads * sizeof(ParallelWorker));
+    pool->threads = (pthread_t*)calloc((size_t)threads, sizeof(pthread_t));
+    if (!pool->workers || !pool->threads) {
+        LOG_ERROR(LOG_CAT_GAME, "parallel_pool_create: Failed to allocate %d workers.", threads);
+        free(pool->workers);
+        free(pool->threads);
+        free(pool);
+        return NULL;
+    }
+    for (int i = 0; i < threads; i++) {
+        atomic_init(&pool->workers[i].range, 0);
+    }
+    pthread_mutex_init(&pool->mutex, NULL);
+    pthread_cond_init(&pool->wake, NULL);
+    pthread_cond_init(&pool->done, NULL);
+
+    // firele care nu pornesc sunt doar un pool mai mic
+    pool->size = 1;
+    for (int i = 1; i < threads; i++) {
+        ParallelThreadArgs* args = (ParallelThreadArgs*)malloc(sizeof(ParallelThreadArgs));
+        if (!args) {
+            break;
+        }
+        *args = (ParallelThreadArgs){pool, i};
+        if (pthread_create(&pool->threads[i], NULL, parallel_thread_main, args) != 0) {
+            LOG_WARN(LOG_CAT_GAME, "parallel_pool_create: Started only %d of %d threads.", i, threads);
+            free(args);
+            break;
+        }
+        pool->size++;
+    }
+    LOG_DEBUG(LOG_CAT_GAME, "parallel_pool_create: %d workers.", pool->size);
+    return pool;
+}
+
+void parallel_pool_destroy(ParallelPool* pool) {
+    if (pool == NULL) {
+        return;
+    }
+    pthread_mutex_lock(&pool->mutex);
+    pool->stop = true;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->mutex);
+    for (int i = 1; i < pool->size; i++) {
+        pthread_join(pool->threads[i], NULL);
+    }
+    pthread_mutex_destroy(&pool->mutex);
+    pthread_cond_destroy(&pool->wake);
+    pthread_cond_destroy(&pool->done);
+    free(pool->workers);
+    free(pool->threads);
+    free(pool);
+}
+
+int parallel_pool_size(const ParallelPool* pool) {
+    return pool ? pool->size : 1;
+}
+
+void parallel_for(ParallelPool* pool, int count, int grain, ParallelTask task, void* context) {
+    if (count <= 0) {
+        return;
+    }
+    if (grain < 1) {
+        grain = 1;
+    }
+    int chunk_count = (count + grain - 1) / grain;
+    if (pool == NULL || pool->size == 1 || chunk_count == 1) {
+        for (int begin = 0; begin < count; begin += grain) {
+            task(context, begin, begin + grain < count ? begin + grain : count, 0);
+        }
+        return;
+    }
+
+    pool->task = task;
+    pool->context = context;
+    pool->count = count;
+    pool->grain = grain;
+    // fiecare fir incepe cu o parte egala, contigua
+    for (int i = 0; i < pool->size; i++) {
+        uint32_t begin = (uint32_t)((int64_t)chunk_count * i / pool->size);
+        uint32_t end = (uint32_t)((int64_t)chunk_count * (i + 1) / pool->size);
+        atomic_store_explicit(&pool->workers[i].range, parallel_pack(begin, end), memory_order_relaxed);
+    }
+
+    pthread_mutex_lock(&pool->mutex);
+    pool->active = pool->size;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->mutex);
+
+    parallel_work(pool, 0);
+
+    pthread_mutex_lock(&pool->mutex);
+    if (--pool->active > 0) {
+        while (pool->active > 0) {
+            pthread_cond_wait(&pool->done, &pool->mutex);
+        }
+    }
+    pthread_mutex_unlock(&pool->mutex);
+}
@@ -0,0 +1,29 @@
+#ifndef __PARALLEL__
+#define __PARALLEL__
+
+#include <stdbool.h>
+
+// Pool de fire fara SDL (pthreads), pentru treburi care se impart in bucati independente:
+// partitionarea din evil mode, tool-urile care joaca tot dictionarul.
+// parallel_for imparte [0, count) in chunk-uri de grain elemente; fiecare fir primeste un sir
+// contiguu de chunk-uri pe care il consuma din fata, iar cand ramane fara fura jumatatea din spate
+// a sirului altui fir (work stealing), asa ca si chunk-urile inegale se echilibreaza singure.
+// Firul care apeleaza parallel_for lucreaza si el (worker 0) si se intoarce abia cand totul e gata.
+// Un singur parallel_for poate rula odata pe un pool.
+
+#define PARALLEL_MAX_THREADS 64
+
+// [begin, end) = un chunk; worker = 0..parallel_pool_size()-1, pentru acumulatori pe fir fara atomice
+typedef void (*ParallelTask)(void* context, int begin, int end, int worker);
+
+typedef struct ParallelPool ParallelPool;
+
+// threads <= 0: cate nuclee are masina. Cu un singur fir nu se porneste nimic, totul ruleaza pe apelant.
+ParallelPool* parallel_pool_create(int threads);
+void parallel_pool_destroy(ParallelPool* pool);
+int parallel_pool_size(const ParallelPool* pool);   // 1 pentru pool == NULL
+int parallel_cpu_count(void);
+// pool == NULL: rulare seriala pe apelant, cu worker 0
+void parallel_for(ParallelPool* pool, int count, int grain, ParallelTask task, void* context);
+
+#endif // __PARALLEL__
@@ -0,0 +1,316 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "pattern_index.h"
+#include "log.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define PATTERN_X86_DISPATCH 1
+#include <immintrin.h>
+#endif
+
+typedef enum {
+    PATTERN_OP_AND,
+    PATTERN_OP_ANDNOT
+} PatternOp;
+
+// ---------------- kernel-uri ----------------
+// dst &= src (sau &= ~src) si popcount pe rezultat, intr-o singura trecere.
+// Varianta generica e compilata de doua ori pe x86 (cu si fara instructiunea popcnt), plus una AVX2;
+// pattern_select_kernels alege la runtime, ca build-ul sa ramana portabil fara -march.
+
+static inline __attribute__((always_inline)) int pattern_apply_generic(uint64_t* dst, const uint64_t* src, int blocks, PatternOp op) {
+    int count = 0;
+    if (op == PATTERN_OP_AND) {
+        for (int i = 0; i < blocks; i++) {
+            dst[i] &= src[i];
+            count += __builtin_popcountll(dst[i]);
+        }
+    } else {
+        for (int i = 0; i < blocks; i++) {
+            dst[i] &= ~src[i];
+            count += __builtin_popcountll(dst[i]);
+        }
+    }
+    return count;
+}
+
+static inline __attribute__((always_inline)) int pattern_and_count_generic(const uint64_t* a, const uint64_t* b, int blocks) {
+    int count = 0;
+    for (int i = 0; i < blocks; i++) {
+        count += __builtin_popcountll(a[i] & b[i]);
+    }
+    return count;
+}
+
+static int pattern_apply_scalar(uint64_t* dst, const uint64_t* src, int blocks, PatternOp op) {
+    return pattern_apply_generic(dst, src, blocks, op);
+}
+
+static int pattern_and_count_scalar(const uint64_t* a, const uint64_t* b, int blocks) {
+    return pattern_and_count_generic(a, b, blocks);
+}
+
+#ifdef PATTERN_X86_DISPATCH
+__attribute__((target("popcnt")))
+static int pattern_apply_popcnt(uint64_t* dst, const uint64_t* src, int blocks, PatternOp op) {
+    return pattern_apply_generic(dst, src, blocks, op);
+}
+
+__attribute__((target("popcnt")))
+static int pattern_and_count_popcnt(const uint64_t* a, const uint64_t* b, int blocks) {
+    return pattern_and_count_generic(a, b, blocks);
+}
+
+// popcount pe 256 de biti cu tabela de nibble-uri (vpshufb), adunat pe 4 x uint64 cu vpsadbw
+__attribute__((target("avx2")))
+static inline __m256i pattern_popcount256(__m256i v) {
+    const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                            0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i low_mask = _mm256_set1_epi8(0x0f);
+    __m256i lo = _mm256_and_si256(v, low_mask);
+    __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), low_mask);
+    __m256i bytes = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, lo), _mm256_shuffle_epi8(lookup, hi));
+    return _mm256_sad_epu8(bytes, _mm256_setzero_si256());
+}
+
+__attribute__((target("avx2")))
+static int pattern_sum256(__m256i total) {
+    return (int)(_mm256_extract_epi64(total, 0) + _mm256_extract_epi64(total, 1) +
+                 _mm256_extract_epi64(total, 2) + _mm256_extract_epi64(total, 3));
+}
+
+__attribute__((target("avx2,popcnt")))
+static int pattern_apply_avx2(uint64_t* dst, const uint64_t* src, int blocks, PatternOp op) {
+    __m256i total = _mm256_setzero_si256();
+    int i = 0;
+    for (; i + 4 <= blocks; i += 4) {
+        __m256i d = _mm256_loadu_si256((const __m256i*)(dst + i));
+        __m256i s = _mm256_loadu_si256((const __m256i*)(src + i));
+        d = (op == PATTERN_OP_AND) ? _mm256_and_si256(d, s) : _mm256_andnot_si256(s, d);
+        _mm256_storeu_si256((__m256i*)(dst + i), d);
+        total = _mm256_add_epi64(total, pattern_popcount256(d));
+    }
+    return pattern_sum256(total) + pattern_apply_generic(dst + i, src + i, blocks - i, op);
+}
+
+__attribute__((target("avx2,popcnt")))
+static int pattern_and_count_avx2(const uint64_t* a, const uint64_t* b, int blocks) {
+    __m256i total = _mm256_setzero_si256();
+    int i = 0;
+    for (; i + 4 <= blocks; i += 4) {
+        __m256i x = _mm256_and_si256(_mm256_loadu_si256((const __m256i*)(a + i)), _mm256_loadu_si256((const __m256i*)(b + i)));
+        total = _mm256_add_epi64(total, pattern_popcount256(x));
+    }
+    return pattern_sum256(total) + pattern_and_count_generic(a + i, b + i, blocks - i);
+}
+#endif
+
+static int (*pattern_apply_kernel)(uint64_t* dst, const uint64_t* src, int blocks, PatternOp op) = pattern_apply_scalar;
+static int (*pattern_and_count_kernel)(const uint64_t* a, const uint64_t* b, int blocks) = pattern_and_count_scalar;
+static pthread_once_t pattern_kernels_once = PTHREAD_ONCE_INIT; // index-uri pe mai multe fire (cache pe limba, bot, pool-uri)
+
+static void pattern_select_kernels(void) {
+#ifdef PATTERN_X86_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt")) {
+        pattern_apply_kernel = pattern_apply_avx2;
+        pattern_and_count_kernel = pattern_and_count_avx2;
+    } else if (__builtin_cpu_supports("popcnt")) {
+        pattern_apply_kernel = pattern_apply_popcnt;
+        pattern_and_count_kernel = pattern_and_count_popcnt;
+    }
+#endif
+}
+
+int pattern_bitset_and_count(const uint64_t* a, const uint64_t* b, int blocks) {
+    return pattern_and_count_kernel(a, b, blocks);
+}
+
+int pattern_bitset_count(const uint64_t* a, int blocks) {
+    return pattern_and_count_kernel(a, a, blocks);
+}
+
+// ---------------- index ----------------
+
+void pattern_index_init(PatternIndex* index, const Dictionary* dictionary) {
+    memset(index, 0, sizeof(PatternIndex));
+    index->dictionary = dictionary;
+    pthread_once(&pattern_kernels_once, pattern_select_kernels);
+}
+
+void pattern_index_free(PatternIndex* index) {
+    if (index == NULL) {
+        return;
+    }
+    for (int len = 0; len <= WORD_INDEX_MAX_LENGTH; len++) {
+        free(index->buckets[len].bits);
+        free(index->buckets[len].letters);
+    }
+    memset(index, 0, sizeof(PatternIndex));
+}
+
+static bool pattern_index_build_bucket(PatternIndex* index, PatternBucket* bucket, int length) {
+    const Dictionary* dict = index->dictionary;
+    const WordIndex* word_index = &dict->index;
+    int word_count = word_index_count_of_length(word_index, length);
+    if (word_count == 0) {
+        return false;
+    }
+
+    int block_count = (word_count + 63) / 64;
+    int stride = (block_count + 3) & ~3;
+    size_t bitset_count = (size_t)(length + 1) * PATTERN_ALPHABET_SIZE;
+    size_t size = bitset_count * (size_t)stride * sizeof(uint64_t);
+    uint64_t* bits = (uint64_t*)aligned_alloc(32, size);
+    if (!bits) {
+        LOG_ERROR(LOG_CAT_DICT, "pattern_index_build: Failed to allocate %zu bytes for length %d.", size, length);
+        return false;
+    }
+    memset(bits, 0, size);
+    char* letters = (char*)calloc((size_t)word_count * length + PATTERN_LETTERS_PADDING, 1);
+    if (!letters) {
+        LOG_ERROR(LOG_CAT_DICT, "pattern_index_build: Failed to allocate the letters of length %d.", length);
+        free(bits);
+        return false;
+    }
+
+    const int* words = word_index->order + word_index->bucket_start[length];
+    uint64_t* letter_base = bits + (size_t)length * PATTERN_ALPHABET_SIZE * stride;
+    for (int j = 0; j < word_count; j++) {
+        const char* word = dictionary_word(dict, words[j]);
+        uint64_t bit = 1ull << (j & 63);
+        int block = j >> 6;
+        // un .bin stricat nu e verificat la incarcare: aici orice litera din afara A-Z ar scrie in afara bitset-urilor
+        for (int p = 0; p < length; p++) {
+            unsigned int letter = (unsigned int)(unsigned char)word[p] - 'A';
+            if (letter >= PATTERN_ALPHABET_SIZE) {
+                LOG_ERROR(LOG_CAT_DICT, "pattern_index_build: Word %d of length %d is not %d letters A-Z.", words[j], length, length);
+                free(bits);
+                free(letters);
+                return false;
+            }
+            bits[(size_t)(p * PATTERN_ALPHABET_SIZE + letter) * stride + block] |= bit;
+        }
+        memcpy(letters + (size_t)j * length, word, length);
+        unsigned int mask = dict->letter_masks[words[j]] & ((1u << PATTERN_ALPHABET_SIZE) - 1);
+        while (mask) {
+            letter_base[(size_t)__builtin_ctz(mask) * stride + block] |= bit;
+            mask &= mask - 1;
+        }
+    }
+
+    bucket->length = length;
+    bucket->word_count = word_count;
+    bucket->block_count = block_count;
+    bucket->stride = stride;
+    bucket->words = words;
+    bucket->bits = bits;
+    bucket->letters = letters;
+    LOG_DEBUG(LOG_CAT_DICT, "pattern_index_build: length %d, %d words, %.1f MB.", length, word_count, (size + (size_t)word_count * length) / 1e6);
+    return true;
+}
+
+const PatternBucket* pattern_index_bucket(PatternIndex* index, int length) {
+    if (index == NULL || index->dictionary == NULL || length < 1 || length > WORD_INDEX_MAX_LENGTH) {
+        return NULL;
+    }
+    PatternBucket* bucket = &index->buckets[length];
+    if (bucket->bits == NULL && !pattern_index_build_bucket(index, bucket, length)) {
+        return NULL;
+    }
+    return bucket;
+}
+
+// toti cuvintele bucket-ului, fara bitii de dupa word_count
+static void pattern_bucket_fill(const PatternBucket* bucket, uint64_t* candidates) {
+    memset(candidates, 0xff, (size_t)bucket->block_count * sizeof(uint64_t));
+    int tail = bucket->word_count & 63;
+    if (tail) {
+        candidates[bucket->block_count - 1] = (1ull << tail) - 1;
+    }
+}
+
+int pattern_bucket_query(const PatternBucket* bucket, const char* pattern, uint32_t excluded_mask, uint64_t* candidates) {
+    pattern_bucket_fill(bucket, candidates);
+    int count = bucket->word_count;
+    int blocks = bucket->block_count;
+    uint32_t revealed_mask = 0;
+    uint32_t unknown_positions = 0;
+
+    // intai literele descoperite: cele mai selective, de obicei golesc repede multimea
+    for (int p = 0; p < bucket->length; p++) {
+        char c = pattern[p];
+        if (c >= 'A' && c <= 'Z') {
+            revealed_mask |= 1u << (c - 'A');
+            count = pattern_apply_kernel(candidates, pattern_bucket_position_bits(bucket, p, c - 'A'), blocks, PATTERN_OP_AND);
+            if (count == 0) {
+                return 0;
+            }
+        } else {
+            unknown_positions |= 1u << p;
+        }
+    }
+
+    uint32_t excluded = excluded_mask & ~revealed_mask;
+    while (excluded && count > 0) {
+        int letter = __builtin_ctz(excluded);
+        excluded &= excluded - 1;
+        count = pattern_apply_kernel(candidates, pattern_bucket_letter_bits(bucket, letter), blocks, PATTERN_OP_ANDNOT);
+    }
+
+    // o litera descoperita apare peste tot unde e in cuvant, deci nu poate fi pe o pozitie necunoscuta
+    while (unknown_positions && count > 0) {
+        int p = __builtin_ctz(unknown_positions);
+        unknown_positions &= unknown_positions - 1;
+        uint32_t letters = revealed_mask;
+        while (letters && count > 0) {
+            int letter = __builtin_ctz(letters);
+            letters &= letters - 1;
+            count = pattern_apply_kernel(candidates, pattern_bucket_position_bits(bucket, p, letter), blocks, PATTERN_OP_ANDNOT);
+        }
+    }
+    return count;
+}
+
+int pattern_bucket_apply_guess(const PatternBucket* bucket, uint64_t* candidates, int letter,
+                               uint32_t positions, uint32_t unknown_positions) {
+    int blocks = bucket->block_count;
+    if (positions == 0) {
+        return pattern_apply_kernel(candidates, pattern_bucket_letter_bits(bucket, letter), blocks, PATTERN_OP_ANDNOT);
+    }
+    int count = 0;
+    uint32_t hit = positions;
+    while (hit) {
+        int p = __builtin_ctz(hit);
+        hit &= hit - 1;
+        count = pattern_apply_kernel(candidates, pattern_bucket_position_bits(bucket, p, letter), blocks, PATTERN_OP_AND);
+    }
+    uint32_t missed = unknown_positions & ~positions;
+    while (missed && count > 0) {
+        int p = __builtin_ctz(missed);
+        missed &= missed - 1;
+        count = pattern_apply_kernel(candidates, pattern_bucket_position_bits(bucket, p, letter), blocks, PATTERN_OP_ANDNOT);
+    }
+    return count;
+}
+
+int pattern_bucket_next(const PatternBucket* bucket, const uint64_t* candidates, int from) {
+    if (from < 0) {
+        from = 0;
+    }
+    if (from >= bucket->word_count) {
+        return -1;
+    }
+    int block = from >> 6;
+    uint64_t bits = candidates[block] & (~0ull << (from & 63));
+    while (!bits) {
+        if (++block >= bucket->block_count) {
+            return -1;
+        }
+        bits = candidates[block];
+    }
+    return block * 64 + __builtin_ctzll(bits);
+}
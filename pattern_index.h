@@ -0,0 +1,67 @@
+#ifndef __PATTERN_INDEX__
+#define __PATTERN_INDEX__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "dictionary.h"
+
+// Index inversat pe bitseturi peste un Dictionary, pentru intrebari de tipul
+// "lungime 5, A__LE, fara R/S/T". Pentru fiecare lungime L, cuvintele de lungime L
+// (in ordinea din WordIndex) sunt numerotate 0..n-1 si fiecare constrangere e un bitset de n biti:
+//   position_bits(p, c) = cuvintele care au litera c pe pozitia p
+//   letter_bits(c)      = cuvintele care contin litera c (absenta = AND NOT)
+// O intrebare e doar AND / AND NOT intre bitseturi plus popcount, cu AVX2 cand procesorul il are.
+// Bucket-ul unei lungimi se construieste la prima folosire (o trecere peste cuvinte);
+// dupa pattern_index_bucket bucket-ul e read-only si poate fi folosit din mai multe fire.
+
+#define PATTERN_ALPHABET_SIZE 26
+#define PATTERN_LETTERS_PADDING 8
+
+typedef struct PatternBucket {
+    int length;
+    int word_count;
+    int block_count;     // uint64_t folositi dintr-un bitset: (word_count + 63) / 64
+    int stride;          // distanta intre doua bitseturi, multiplu de 4 (32 octeti)
+    const int* words;    // words[j] = indicele in Dictionary al cuvantului j din bucket
+    char* letters;       // letters + j * length = literele cuvantului j, contiguu (fara '\0'), pentru parcurgeri pe candidati;
+                         // urmat de PATTERN_LETTERS_PADDING octeti 0, ca ultimul cuvant sa poata fi citit cate 8 litere odata
+    uint64_t* bits;      // (length + 1) * 26 bitseturi: intai pozitie x litera, apoi prezenta fiecarei litere
+} PatternBucket;
+
+typedef struct PatternIndex {
+    const Dictionary* dictionary;   // imprumutat, trebuie sa traiasca mai mult decat indexul
+    PatternBucket buckets[WORD_INDEX_MAX_LENGTH + 1];
+} PatternIndex;
+
+void pattern_index_init(PatternIndex* index, const Dictionary* dictionary);
+void pattern_index_free(PatternIndex* index);
+// NULL daca nu exista cuvinte de lungimea asta sau alocarea a esuat; construieste bucket-ul la nevoie (nu e thread-safe)
+const PatternBucket* pattern_index_bucket(PatternIndex* index, int length);
+
+static inline const uint64_t* pattern_bucket_position_bits(const PatternBucket* bucket, int position, int letter) {
+    return bucket->bits + (size_t)(position * PATTERN_ALPHABET_SIZE + letter) * bucket->stride;
+}
+
+static inline const char* pattern_bucket_word(const PatternBucket* bucket, int j) {
+    return bucket->letters + (size_t)j * bucket->length;
+}
+
+static inline const uint64_t* pattern_bucket_letter_bits(const PatternBucket* bucket, int letter) {
+    return bucket->bits + (size_t)(bucket->length * PATTERN_ALPHABET_SIZE + letter) * bucket->stride;
+}
+
+// candidates are block_count uint64_t. Intorc cati candidati au ramas.
+// pattern: length caractere, 'A'-'Z' = litera descoperita, orice altceva = pozitie necunoscuta.
+// Pe o pozitie necunoscuta nu poate fi nici o litera descoperita (ar fi fost afisata), nici una exclusa.
+int pattern_bucket_query(const PatternBucket* bucket, const char* pattern, uint32_t excluded_mask, uint64_t* candidates);
+// Filtrare incrementala dupa o litera incercata: positions = unde a aparut (0 = ratare),
+// unknown_positions = pozitiile inca necunoscute inainte de incercare.
+int pattern_bucket_apply_guess(const PatternBucket* bucket, uint64_t* candidates, int letter,
+                               uint32_t positions, uint32_t unknown_positions);
+int pattern_bucket_next(const PatternBucket* bucket, const uint64_t* candidates, int from); // -1 la sfarsit
+
+// popcount(a & b) peste blocks uint64_t, fara scriere
+int pattern_bitset_and_count(const uint64_t* a, const uint64_t* b, int blocks);
+int pattern_bitset_count(const uint64_t* a, int blocks);
+
+#endif // __PATTERN_INDEX__
@@ -0,0 +1,209 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <SDL2/SDL_ttf.h>
+
+#include "perf.h"
+#include "interface.h"   // render_text
+#include "log.h"
+
+#define PERF_OVERLAY_LINES 10
+#define PERF_GRAPH_HEIGHT 60
+#define PERF_GRAPH_MAX_MS 50.0f   // varful graficului; frame-urile mai lungi sunt taiate
+
+typedef struct PerfFrame {
+    float frame_ms;                     // de la inceputul frame-ului pana la inceputul urmatorului (cu asteptarea)
+    float phase_ms[PERF_PHASE_COUNT];
+    int counters[PERF_COUNTER_COUNT];
+} PerfFrame;
+
+static const char* perf_phase_names[PERF_PHASE_COUNT] = {
+    "handle_events", "update", "render", "overlay", "SDL_RenderPresent"
+};
+
+static struct {
+    PerfFrame history[PERF_HISTORY_SIZE];   // buffer circular, head = urmatorul slot
+    int head;
+    int count;
+    Uint64 frequency;
+    Uint64 frame_start;
+    Uint64 phase_start[PERF_PHASE_COUNT];
+    float phase_ms[PERF_PHASE_COUNT];
+    int counters[PERF_COUNTER_COUNT];
+    const char* render_label;
+
+    bool visible;
+    TTF_Font* font;
+    Uint32 last_refresh;
+    char lines[PERF_OVERLAY_LINES][96];
+    int line_count;
+} perf_state;
+
+static float perf_ms_since(Uint64 start) {
+    return (float)((double)(SDL_GetPerformanceCounter() - start) * 1000.0 / (double)perf_state.frequency);
+}
+
+void perf_frame_begin(void) {
+    if (perf_state.frequency == 0) {
+        perf_state.frequency = SDL_GetPerformanceFrequency();
+    }
+    Uint64 now = SDL_GetPerformanceCounter();
+    // intervalul complet al frame-ului anterior se stie abia acum
+    if (perf_state.count > 0 && perf_state.frame_start != 0) {
+        int last = (perf_state.head + PERF_HISTORY_SIZE - 1) % PERF_HISTORY_SIZE;
+        perf_state.history[last].frame_ms = (float)((double)(now - perf_state.frame_start) * 1000.0 / (double)perf_state.frequency);
+    }
+    perf_state.frame_start = now;
+}
+
+void perf_phase_begin(PerfPhase phase) {
+    perf_state.phase_start[phase] = SDL_GetPerformanceCounter();
+}
+
+void perf_phase_end(PerfPhase phase) {
+    perf_state.phase_ms[phase] += perf_ms_since(perf_state.phase_start[phase]);
+}
+
+void perf_count(PerfCounter counter, int amount) {
+    perf_state.counters[counter] += amount;
+}
+
+void perf_frame_end(const char* render_label) {
+    PerfFrame* frame = &perf_state.history[perf_state.head];
+    frame->frame_ms = perf_ms_since(perf_state.frame_start); // provizoriu, completat de perf_frame_begin
+    memcpy(frame->phase_ms, perf_state.phase_ms, sizeof(frame->phase_ms));
+    memcpy(frame->counters, perf_state.counters, sizeof(frame->counters));
+    memset(perf_state.phase_ms, 0, sizeof(perf_state.phase_ms));
+    memset(perf_state.counters, 0, sizeof(perf_state.counters));
+    perf_state.render_label = render_label;
+    perf_state.head = (perf_state.head + 1) % PERF_HISTORY_SIZE;
+    if (perf_state.count < PERF_HISTORY_SIZE) {
+        perf_state.count++;
+    }
+}
+
+// ---------------- overlay ----------------
+
+bool perf_overlay_init(const char* font_path) {
+    const char* env = SDL_getenv("HANGMAN_PERF_OVERLAY");
+    perf_state.visible = (env != NULL && env[0] == '1');
+    perf_state.font = TTF_OpenFont(font_path, PERF_OVERLAY_FONT_SIZE);
+    if (!perf_state.font) {
+        LOG_WARN(LOG_CAT_RENDER, "perf_overlay_init: Failed to load overlay font: %s", TTF_GetError());
+        perf_state.visible = false;
+        return false;
+    }
+    return true;
+}
+
+void perf_overlay_toggle(void) {
+    if (perf_state.font) {
+        perf_state.visible = !perf_state.visible;
+        perf_state.last_refresh = 0;
+    }
+}
+
+bool perf_overlay_visible(void) {
+    return perf_state.visible;
+}
+
+void perf_overlay_cleanup(void) {
+    if (perf_state.font) {
+        TTF_CloseFont(perf_state.font);
+        perf_state.font = NULL;
+    }
+    perf_state.visible = false;
+}
+
+static int perf_compare_float(const void* a, const void* b) {
+    float x = *(const float*)a;
+    float y = *(const float*)b;
+    return (x > y) - (x < y);
+}
+
+// Textul se recalculeaza doar la PERF_OVERLAY_REFRESH_MS, ca cifrele sa poata fi citite (si sortarea sa nu ruleze pe fiecare frame).
+static void perf_overlay_refresh(void) {
+    int n = perf_state.count;
+    if (n == 0) {
+        perf_state.line_count = 0;
+        return;
+    }
+    float sorted[PERF_HISTORY_SIZE];
+    float phase_sum[PERF_PHASE_COUNT] = {0};
+    int counter_max[PERF_COUNTER_COUNT] = {0};
+    double frame_sum = 0.0;
+    for (int i = 0; i < n; i++) {
+        const PerfFrame* frame = &perf_state.history[i];
+        sorted[i] = frame->frame_ms;
+        frame_sum += frame->frame_ms;
+        for (int p = 0; p < PERF_PHASE_COUNT; p++) {
+            phase_sum[p] += frame->phase_ms[p];
+        }
+        for (int c = 0; c < PERF_COUNTER_COUNT; c++) {
+            if (frame->counters[c] > counter_max[c]) {
+                counter_max[c] = frame->counters[c];
+            }
+        }
+    }
+    qsort(sorted, (size_t)n, sizeof(float), perf_compare_float);
+    const PerfFrame* last = &perf_state.history[(perf_state.head + PERF_HISTORY_SIZE - 1) % PERF_HISTORY_SIZE];
+
+    int line = 0;
+    snprintf(perf_state.lines[line++], sizeof(perf_state.lines[0]), "%.0f fps  frame p50 %.2f  p95 %.2f  p99 %.2f  max %.2f ms",
+             frame_sum > 0.0 ? n * 1000.0 / frame_sum : 0.0,
+             sorted[(n - 1) * 50 / 100], sorted[(n - 1) * 95 / 100], sorted[(n - 1) * 99 / 100], sorted[n - 1]);
+    for (int p = 0; p < PERF_PHASE_COUNT; p++) {
+        const char* name = (p == PERF_PHASE_RENDER && perf_state.render_label) ? perf_state.render_label : perf_phase_names[p];
+        snprintf(perf_state.lines[line++], sizeof(perf_state.lines[0]), "%-20s %7.3f ms", name, phase_sum[p] / n);
+    }
+    snprintf(perf_state.lines[line++], sizeof(perf_state.lines[0]), "textures created/frame %d (max %d)",
+             last->counters[PERF_COUNTER_TEXTURE_CREATE], counter_max[PERF_COUNTER_TEXTURE_CREATE]);
+    snprintf(perf_state.lines[line++], sizeof(perf_state.lines[0]), "text rasterized/frame  %d (max %d)",
+             last->counters[PERF_COUNTER_TEXT_RASTER], counter_max[PERF_COUNTER_TEXT_RASTER]);
+    perf_state.line_count = line;
+}
+
+void perf_overlay_render(SDL_Renderer* renderer) {
+    if (!perf_state.visible || !perf_state.font) {
+        return;
+    }
+    Uint32 now = SDL_GetTicks();
+    if (perf_state.last_refresh == 0 || now - perf_state.last_refresh >= PERF_OVERLAY_REFRESH_MS) {
+        perf_overlay_refresh();
+        perf_state.last_refresh = now;
+    }
+
+    int line_height = TTF_FontLineSkip(perf_state.font);
+    SDL_Rect panel = {10, 10, 430, perf_state.line_count * line_height + PERF_GRAPH_HEIGHT + 20};
+    SDL_BlendMode blend_mode;
+    SDL_GetRenderDrawBlendMode(renderer, &blend_mode);
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 190);
+    SDL_RenderFillRect(renderer, &panel);
+
+    SDL_Color text_color = {230, 230, 230, 255};
+    for (int i = 0; i < perf_state.line_count; i++) {
+        render_text(renderer, perf_state.font, perf_state.lines[i], text_color, panel.x + 8, panel.y + 5 + i * line_height);
+    }
+
+    // graficul: un punct pe frame, cel mai vechi in stanga; linii de referinta la 60 si 30 fps
+    int graph_x = panel.x + 8;
+    int graph_bottom = panel.y + panel.h - 8;
+    float scale = PERF_GRAPH_HEIGHT / PERF_GRAPH_MAX_MS;
+    SDL_SetRenderDrawColor(renderer, 60, 160, 60, 255);
+    SDL_RenderDrawLine(renderer, graph_x, graph_bottom - (int)(16.7f * scale), graph_x + PERF_HISTORY_SIZE, graph_bottom - (int)(16.7f * scale));
+    SDL_SetRenderDrawColor(renderer, 170, 60, 60, 255);
+    SDL_RenderDrawLine(renderer, graph_x, graph_bottom - (int)(33.3f * scale), graph_x + PERF_HISTORY_SIZE, graph_bottom - (int)(33.3f * scale));
+
+    SDL_Point points[PERF_HISTORY_SIZE];
+    int oldest = (perf_state.head + PERF_HISTORY_SIZE - perf_state.count) % PERF_HISTORY_SIZE;
+    for (int i = 0; i < perf_state.count; i++) {
+        float ms = perf_state.history[(oldest + i) % PERF_HISTORY_SIZE].frame_ms;
+        if (ms > PERF_GRAPH_MAX_MS) ms = PERF_GRAPH_MAX_MS;
+        points[i] = (SDL_Point){graph_x + i, graph_bottom - (int)(ms * scale)};
+    }
+    SDL_SetRenderDrawColor(renderer, 240, 220, 80, 255);
+    SDL_RenderDrawLines(renderer, points, perf_state.count);
+
+    SDL_SetRenderDrawBlendMode(renderer, blend_mode);
+}
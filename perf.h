@@ -0,0 +1,40 @@
+#ifndef __PERF__
+#define __PERF__
+
+#include <SDL2/SDL.h>
+#include <stdbool.h>
+
+// Timpii pe frame, masurati pe firul principal cu SDL_GetPerformanceCounter, si overlay-ul care ii arata (F3).
+// Fazele unui frame: evenimente, update, render-ul modului curent, overlay-ul insusi si SDL_RenderPresent.
+#define PERF_HISTORY_SIZE 240          // ~4 secunde la 60 fps
+#define PERF_OVERLAY_REFRESH_MS 250    // cat de des se recalculeaza textul overlay-ului
+#define PERF_OVERLAY_FONT_SIZE 16
+
+typedef enum {
+    PERF_PHASE_EVENTS,
+    PERF_PHASE_UPDATE,
+    PERF_PHASE_RENDER,
+    PERF_PHASE_OVERLAY,
+    PERF_PHASE_PRESENT,
+    PERF_PHASE_COUNT
+} PerfPhase;
+
+typedef enum {
+    PERF_COUNTER_TEXTURE_CREATE,   // orice SDL_CreateTexture* / IMG_LoadTexture
+    PERF_COUNTER_TEXT_RASTER,      // orice TTF_Render* (text sau glyph)
+    PERF_COUNTER_COUNT
+} PerfCounter;
+
+void perf_frame_begin(void);
+void perf_phase_begin(PerfPhase phase);
+void perf_phase_end(PerfPhase phase);
+void perf_frame_end(const char* render_label); // render_label = functia de render a modului din frame-ul asta
+void perf_count(PerfCounter counter, int amount);
+
+bool perf_overlay_init(const char* font_path);
+void perf_overlay_toggle(void);
+bool perf_overlay_visible(void);
+void perf_overlay_render(SDL_Renderer* renderer);
+void perf_overlay_cleanup(void);
+
+#endif // __PERF__
@@ -0,0 +1,92 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "render_layer.h"
+#include "interface.h"   // For WIDTH, HEIGHT
+#include "perf.h"
+#include "log.h"
+
+static bool render_layer_create(RenderLayer* layer, SDL_Renderer* renderer) {
+    if (!SDL_RenderTargetSupported(renderer)) {
+        LOG_WARN(LOG_CAT_RENDER, "render_layer_create: Render targets not supported, drawing directly.");
+        layer->unsupported = true;
+        return false;
+    }
+    layer->texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_TARGET, WIDTH, HEIGHT);
+    perf_count(PERF_COUNTER_TEXTURE_CREATE, 1);
+    if (!layer->texture) {
+        LOG_WARN(LOG_CAT_RENDER, "render_layer_create: Failed to create layer texture: %s", SDL_GetError());
+        layer->unsupported = true;
+        return false;
+    }
+    SDL_SetTextureBlendMode(layer->texture, SDL_BLENDMODE_BLEND); // zonele nedesenate raman transparente
+    return true;
+}
+
+// true = apelantul trebuie sa deseneze stratul acum (tinta e deja texture-ul stratului, curatat)
+bool render_layer_begin(RenderLayer* layer, SDL_Renderer* renderer, uint64_t key) {
+    if (layer->unsupported) {
+        return true;
+    }
+    if (layer->texture == NULL && !render_layer_create(layer, renderer)) {
+        return true;
+    }
+    if (layer->valid && layer->key == key) {
+        return false;
+    }
+    if (SDL_SetRenderTarget(renderer, layer->texture) != 0) {
+        LOG_WARN(LOG_CAT_RENDER, "render_layer_begin: SDL_SetRenderTarget failed: %s", SDL_GetError());
+        render_layer_destroy(layer);
+        layer->unsupported = true;
+        return true;
+    }
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+    SDL_RenderClear(renderer);
+    layer->key = key;
+    layer->valid = true;
+    return true;
+}
+
+void render_layer_end(RenderLayer* layer, SDL_Renderer* renderer) {
+    if (layer->unsupported) {
+        return;
+    }
+    SDL_SetRenderTarget(renderer, NULL);
+}
+
+void render_layer_draw(const RenderLayer* layer, SDL_Renderer* renderer) {
+    if (layer->unsupported || layer->texture == NULL || !layer->valid) {
+        return; // a fost desenat direct pe ecran de render_layer_begin/end
+    }
+    SDL_RenderCopy(renderer, layer->texture, NULL, NULL);
+}
+
+// dupa SDL_RENDER_TARGETS_RESET continutul texturilor target se pierde
+void render_layer_invalidate(RenderLayer* layer) {
+    layer->valid = false;
+}
+
+void render_layer_destroy(RenderLayer* layer) {
+    if (layer->texture) {
+        SDL_DestroyTexture(layer->texture);
+    }
+    memset(layer, 0, sizeof(RenderLayer));
+}
+
+uint64_t render_layer_key_bytes(uint64_t key, const void* data, size_t size) {
+    const unsigned char* bytes = (const unsigned char*)data;
+    for (size_t i = 0; i < size; i++) {
+        key ^= bytes[i];
+        key *= 1099511628211ull;
+    }
+    return key;
+}
+
+uint64_t render_layer_key_string(uint64_t key, const char* text) {
+    return render_layer_key_bytes(key, text, strlen(text) + 1); // cu '\0', ca "AB"+"C" sa difere de "A"+"BC"
+}
+
+uint64_t render_layer_key_int(uint64_t key, long value) {
+    return render_layer_key_bytes(key, &value, sizeof(value));
+}
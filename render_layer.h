@@ -0,0 +1,34 @@
+#ifndef __RENDER_LAYER__
+#define __RENDER_LAYER__
+
+#include <SDL2/SDL.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define RENDER_LAYER_KEY_INIT 14695981039346656037ull   // FNV-1a pe 64 de biti
+
+// Un strat al ecranului pastrat intr-o textura SDL_TEXTUREACCESS_TARGET cat fereastra.
+// key rezuma tot ce se vede in strat (litere ghicite, wrong_guesses, displayed_word...);
+// stratul e redesenat doar cand key se schimba sau cand a fost invalidat.
+typedef struct RenderLayer {
+    SDL_Texture* texture;
+    uint64_t key;
+    bool valid;
+    bool unsupported;   // renderer fara render targets: se deseneaza direct pe ecran la fiecare frame
+} RenderLayer;
+
+// Folosire:
+//   if (render_layer_begin(&layer, renderer, key)) { ...desenare...; render_layer_end(&layer, renderer); }
+//   render_layer_draw(&layer, renderer);
+bool render_layer_begin(RenderLayer* layer, SDL_Renderer* renderer, uint64_t key);
+void render_layer_end(RenderLayer* layer, SDL_Renderer* renderer);
+void render_layer_draw(const RenderLayer* layer, SDL_Renderer* renderer);
+void render_layer_invalidate(RenderLayer* layer);
+void render_layer_destroy(RenderLayer* layer);
+
+uint64_t render_layer_key_bytes(uint64_t key, const void* data, size_t size);
+uint64_t render_layer_key_string(uint64_t key, const char* text);
+uint64_t render_layer_key_int(uint64_t key, long value);
+
+#endif // __RENDER_LAYER__
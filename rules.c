@@ -0,0 +1,522 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "rules.h"
+#include "log.h"
+
+const RulesBalance rules_default_balance = {
+    INITIAL_HARD_MODE_TIME_SECONDS,
+    TIME_BONUS_WIN_SECONDS,
+    WRONG_GUESS_BONUS_WIN,
+    INITIAL_VERSUS_MODE_TIME_SECONDS,
+    TIME_BONUS_GUESS_SECONDS,
+    WORDS_TO_WIN_VERSUS_MODE,
+};
+
+static const RulesBalance* rules_balance(const RulesEnv* env) {
+    return env->balance ? env->balance : &rules_default_balance;
+}
+
+// "" vine doar dintr-un .bin stricat (vezi dictionary_word); pentru apelanti e la fel ca niciun cuvant
+static const char* rules_dictionary_word(const Dictionary* dictionary, int word_idx) {
+    const char* word = dictionary_word(dictionary, word_idx);
+    return word[0] != '\0' ? word : NULL;
+}
+
+const char* rules_pick_word(const Dictionary* dictionary, int length, const RulesEnv* env) {
+    if (dictionary == NULL || dictionary->word_count == 0) {
+        return NULL;
+    }
+    unsigned int random_value = env->rand(env->rand_data);
+    if (length <= 0) {
+        return rules_dictionary_word(dictionary, (int)(random_value % (unsigned int)dictionary->word_count));
+    }
+    int word_idx = word_index_pick(&dictionary->index, length, random_value);
+    return word_idx < 0 ? NULL : rules_dictionary_word(dictionary, word_idx);
+}
+
+bool rules_has_difficulty(const Dictionary* dictionary) {
+    return dictionary != NULL && difficulty_index_ready(&dictionary->difficulty_index);
+}
+
+const char* rules_pick_word_at_level(const Dictionary* dictionary, int level, int min_length, int max_length, const RulesEnv* env) {
+    if (dictionary == NULL || dictionary->word_count == 0) {
+        return NULL;
+    }
+    if (!rules_has_difficulty(dictionary)) {
+        unsigned int random_value = env->rand(env->rand_data);
+        int length = word_index_random_length(&dictionary->index, min_length, max_length, random_value);
+        return length > 0 ? rules_pick_word(dictionary, length, env) : NULL;
+    }
+    int word_idx = difficulty_index_pick(&dictionary->difficulty_index, level, min_length, max_length, env->rand(env->rand_data));
+    return word_idx < 0 ? NULL : rules_dictionary_word(dictionary, word_idx);
+}
+
+// caracterele care nu sunt litere (nu ar trebui sa existe in dictionar) sunt mereu vizibile
+static bool rules_letter_revealed(const HangmanGame* hangman, char c) {
+    if (c < 'A' || c > 'Z') {
+        return true;
+    }
+    return hangman->guessed_letters[c - 'A'];
+}
+
+// toate literele cuvantului au fost incercate; caracterele care nu sunt litere nu intra in masca
+bool rules_word_complete(const HangmanGame* hangman) {
+    return (hangman->word_letter_mask & ~hangman->guessed_mask) == 0;
+}
+
+// normal/hard afiseaza "A _ B " (spatiu dupa fiecare litera), versus "A _ B"; in ambele litera p e la displayed_word[2 * p]
+static void rules_format_word(HangmanGame* hangman, bool trailing_space) {
+    char* out = hangman->displayed_word;
+    for (const char* p = hangman->word; *p; p++) {
+        *out++ = rules_letter_revealed(hangman, *p) ? *p : '_';
+        if (trailing_space || p[1] != '\0') {
+            *out++ = ' ';
+        }
+    }
+    *out = '\0';
+}
+
+// litera mare A-Z sau '\0' daca nu e litera
+static char rules_normalize_letter(char letter) {
+    if (letter >= 'a' && letter <= 'z') {
+        letter = letter - 32;
+    }
+    return (letter >= 'A' && letter <= 'Z') ? letter : '\0';
+}
+
+// Cuvant nou, fara litere incercate. Tabelele rundei se fac aici, o singura data:
+// masca literelor din cuvant si, pentru fiecare litera, pozitiile pe care apare.
+static bool rules_set_word(HangmanGame* hangman, const char* word, bool trailing_space) {
+    if (word == NULL) {
+        return false;
+    }
+    strncpy(hangman->word, word, MAX_WORD_LENGTH);
+    hangman->word[MAX_WORD_LENGTH] = '\0';
+
+    hangman->word_letter_mask = 0;
+    memset(hangman->letter_positions, 0, sizeof(hangman->letter_positions));
+    int length = 0;
+    for (; hangman->word[length]; length++) {
+        char c = hangman->word[length];
+        if (c >= 'A' && c <= 'Z') {
+            hangman->word_letter_mask |= 1u << (c - 'A');
+            hangman->letter_positions[c - 'A'] |= 1u << length;
+        }
+    }
+    hangman->word_length = length;
+
+    memset(hangman->guessed_letters, 0, sizeof(hangman->guessed_letters));
+    hangman->guessed_mask = 0;
+    rules_format_word(hangman, trailing_space);
+    return true;
+}
+
+// Marcheaza litera (index 0..25) ca incercata si o scrie doar pe pozitiile ei din displayed_word.
+// Intoarce true daca litera e in cuvant.
+static bool rules_reveal_letter(HangmanGame* hangman, int index) {
+    hangman->guessed_letters[index] = true;
+    hangman->guessed_mask |= 1u << index;
+    uint32_t positions = hangman->letter_positions[index];
+    while (positions) {
+        int position = __builtin_ctz(positions);
+        hangman->displayed_word[2 * position] = (char)('A' + index);
+        positions &= positions - 1;
+    }
+    return (hangman->word_letter_mask >> index) & 1u;
+}
+
+// ---------------- normal ----------------
+
+static void rules_normal_update(HangmanGame* hangman) {
+    if (rules_word_complete(hangman)) {
+        hangman->game_over = true;
+        hangman->win = true;
+    } else if (hangman->wrong_guesses >= MAX_WRONG_GUESSES) {
+        hangman->game_over = true;
+        hangman->win = false;
+    }
+}
+
+void rules_normal_init(HangmanGame* hangman) {
+    hangman->difficulty_level = NORMAL_START_DIFFICULTY_LEVEL;
+    hangman->game_over = false;
+}
+
+bool rules_normal_reset(HangmanGame* hangman, const RulesEnv* env) {
+    if (!rules_has_difficulty(hangman->dictionary)) {
+        return rules_normal_start(hangman, rules_pick_word(hangman->dictionary, 0, env));
+    }
+    // doar dupa o partida terminata; un reset in mijlocul partidei pastreaza nivelul
+    if (hangman->game_over) {
+        hangman->difficulty_level += hangman->win ? 1 : -1;
+        if (hangman->difficulty_level < 0) {
+            hangman->difficulty_level = 0;
+        } else if (hangman->difficulty_level >= DIFFICULTY_LEVELS) {
+            hangman->difficulty_level = DIFFICULTY_LEVELS - 1;
+        }
+    }
+    return rules_normal_start(hangman, rules_pick_word_at_level(hangman->dictionary, hangman->difficulty_level,
+                                                                1, WORD_INDEX_MAX_LENGTH, env));
+}
+
+bool rules_normal_start(HangmanGame* hangman, const char* word) {
+    if (!rules_set_word(hangman, word, true)) {
+        LOG_ERROR(LOG_CAT_RULES, "rules_normal_start: No word available.");
+        hangman->game_over = true; // e game over pe true si win pe false
+        hangman->win = false;
+        return false;
+    }
+    hangman->wrong_guesses = 0;
+    hangman->game_over = false;
+    hangman->win = false;
+    rules_normal_update(hangman);
+    return true;
+}
+
+RulesGuessResult rules_normal_guess(HangmanGame* hangman, char letter) {
+    letter = rules_normalize_letter(letter);
+    if (hangman->game_over || letter == '\0' || hangman->guessed_letters[letter - 'A']) {
+        return RULES_GUESS_IGNORED;
+    }
+    bool found = rules_reveal_letter(hangman, letter - 'A');
+    if (!found) {
+        hangman->wrong_guesses++;
+    }
+    rules_normal_update(hangman);
+    return found ? RULES_GUESS_HIT : RULES_GUESS_MISS;
+}
+
+// ---------------- hard ----------------
+
+// Runda castigata nu e game over: win ramane true ROUND_WIN_DISPLAY_DURATION ms, apoi rules_hard_tick trece la cuvantul urmator.
+static void rules_hard_update(HangmanGame* hangman, const RulesEnv* env) {
+    if (rules_word_complete(hangman)) {
+        hangman->win = true;
+        hangman->win_previous_round = true;
+        hangman->current_round_time_limit_ms += (rules_balance(env)->time_bonus_win_seconds * 1000L);
+        hangman->wrong_guesses -= rules_balance(env)->wrong_guess_bonus_win;
+        if (hangman->wrong_guesses < 0) {
+            hangman->wrong_guesses = 0;
+        }
+        hangman->round_won_display_time = env->now_ms(env->clock_data);
+    } else if (hangman->wrong_guesses >= MAX_WRONG_GUESSES) {
+        hangman->game_over = true;
+        hangman->win = false;
+        hangman->win_previous_round = false;
+    }
+}
+
+void rules_hard_init(HangmanGame* hangman, const RulesEnv* env) {
+    hangman->current_word_length = INITIAL_WORD_LENGTH;
+    hangman->difficulty_level = 0;
+    hangman->current_round_time_limit_ms = rules_balance(env)->initial_hard_mode_time_seconds * 1000L;
+    hangman->win_previous_round = false;
+    hangman->round_won_display_time = 0;
+    rules_hard_reset(hangman, env);
+}
+
+// ultima runda a fost ghicita: castig final, se asteapta click pentru joc nou
+static bool rules_hard_final_win(HangmanGame* hangman) {
+    hangman->current_word_length = INITIAL_WORD_LENGTH;
+    hangman->difficulty_level = 0;
+    hangman->game_over = true;
+    hangman->win = true;
+    hangman->win_previous_round = false;
+    return false;
+}
+
+// true daca a inceput o runda noua; false la castigul final (game_over + win) sau daca nu exista cuvant
+bool rules_hard_reset(HangmanGame* hangman, const RulesEnv* env) {
+    if (hangman->dictionary == NULL) {
+        LOG_ERROR(LOG_CAT_RULES, "rules_hard_reset: No word list.");
+        hangman->game_over = true;
+        hangman->win = false;
+        return false;
+    }
+    const WordIndex* index = &hangman->dictionary->index;
+    const char* word = NULL;
+
+    if (rules_has_difficulty(hangman->dictionary)) {
+        // runda k cere nivelul k; lungimea conteaza doar cat sa ramana in limitele hard mode
+        if (hangman->win_previous_round) {
+            if (hangman->difficulty_level + 1 >= DIFFICULTY_LEVELS) {
+                return rules_hard_final_win(hangman);
+            }
+            hangman->difficulty_level++;
+        } else {
+            hangman->difficulty_level = 0;
+        }
+        word = rules_pick_word_at_level(hangman->dictionary, hangman->difficulty_level,
+                                        INITIAL_WORD_LENGTH, MAX_GAME_WORD_LENGTH, env);
+        if (word) {
+            hangman->current_word_length = (int)strlen(word);
+        }
+    } else {
+        // doar lungimi care exista in lista de cuvinte
+        if (hangman->win_previous_round) {
+            int next_length = word_index_next_length(index, hangman->current_word_length);
+            if (next_length <= 0 || next_length > MAX_GAME_WORD_LENGTH) {
+                // cel mai lung cuvant posibil a fost ghicit
+                return rules_hard_final_win(hangman);
+            }
+            hangman->current_word_length = next_length;
+        } else {
+            hangman->current_word_length = INITIAL_WORD_LENGTH;
+            if (!word_index_has_length(index, INITIAL_WORD_LENGTH)) {
+                hangman->current_word_length = word_index_next_length(index, INITIAL_WORD_LENGTH);
+            }
+        }
+        word = rules_pick_word(hangman->dictionary, hangman->current_word_length, env);
+    }
+
+    if (!rules_set_word(hangman, word, true)) {
+        LOG_ERROR(LOG_CAT_RULES, "rules_hard_reset: No words found of length %d.", hangman->current_word_length);
+        hangman->game_over = true;
+        hangman->win = false;
+        return false;
+    }
+
+    hangman->wrong_guesses = 0;
+    hangman->game_over = false;
+    hangman->win = false;
+    hangman->round_won_display_time = 0;
+
+    hangman->start_time_ms = env->now_ms(env->clock_data);
+    // dupa un castig limita are deja bonusul adaugat de rules_hard_update; altfel se porneste de la inceput
+    if (!hangman->win_previous_round || hangman->current_round_time_limit_ms == 0) {
+        hangman->current_round_time_limit_ms = rules_balance(env)->initial_hard_mode_time_seconds * 1000L;
+    }
+    hangman->time_left_ms = hangman->current_round_time_limit_ms;
+    hangman->win_previous_round = false;
+
+    rules_hard_update(hangman, env);
+    return true;
+}
+
+RulesGuessResult rules_hard_guess(HangmanGame* hangman, const RulesEnv* env, char letter) {
+    letter = rules_normalize_letter(letter);
+    // in timpul mesajului de runda castigata (win && !game_over) tastele sunt ignorate
+    if (hangman->game_over || hangman->win || letter == '\0' || hangman->guessed_letters[letter - 'A']) {
+        return RULES_GUESS_IGNORED;
+    }
+    bool found = rules_reveal_letter(hangman, letter - 'A');
+    if (!found) {
+        hangman->wrong_guesses++;
+    }
+    rules_hard_update(hangman, env);
+    return found ? RULES_GUESS_HIT : RULES_GUESS_MISS;
+}
+
+void rules_hard_tick(HangmanGame* hangman, const RulesEnv* env) {
+    long now = env->now_ms(env->clock_data);
+    if (!hangman->game_over && !hangman->win) {
+        hangman->time_left_ms = hangman->current_round_time_limit_ms - (now - hangman->start_time_ms);
+        if (hangman->time_left_ms <= 0) {
+            hangman->time_left_ms = 0;
+            hangman->game_over = true;
+            hangman->win = false;
+            hangman->win_previous_round = false;
+        }
+    }
+    if (hangman->win && !hangman->game_over && now - hangman->round_won_display_time >= ROUND_WIN_DISPLAY_DURATION) {
+        rules_hard_reset(hangman, env);
+    }
+}
+
+// ---------------- evil ----------------
+
+// Evil mode (evil.c) nu alege cuvantul dinainte: word e doar un reprezentant al cuvintelor inca posibile,
+// schimbat inaintea fiecarei litere. Incercarea in sine e cea din normal mode (rules_normal_guess).
+bool rules_evil_reset(HangmanGame* hangman, const char* word) {
+    if (!rules_set_word(hangman, word, true)) {
+        LOG_ERROR(LOG_CAT_RULES, "rules_evil_reset: No word available.");
+        hangman->game_over = true;
+        hangman->win = false;
+        return false;
+    }
+    hangman->wrong_guesses = 0;
+    hangman->game_over = false;
+    hangman->win = false;
+    rules_normal_update(hangman);
+    return true;
+}
+
+// word trebuie sa aiba aceeasi lungime si aceleasi litere descoperite pe aceleasi pozitii
+void rules_evil_replace_word(HangmanGame* hangman, const char* word) {
+    bool guessed_letters[ALPHABET_SIZE];
+    uint32_t guessed_mask = hangman->guessed_mask;
+    memcpy(guessed_letters, hangman->guessed_letters, sizeof(guessed_letters));
+    rules_set_word(hangman, word, true);
+    memcpy(hangman->guessed_letters, guessed_letters, sizeof(guessed_letters));
+    hangman->guessed_mask = guessed_mask;
+    rules_format_word(hangman, true);
+}
+
+// ---------------- versus ----------------
+
+// reconstruieste tot displayed_word din guessed_letters; rundele normale il actualizeaza doar la literele ghicite
+void rules_versus_update_displayed_word(HangmanGame* hangman) {
+    rules_format_word(hangman, false);
+}
+
+int rules_versus_words_to_win(const VersusHangman* versus) {
+    return versus->words_to_win > 0 ? versus->words_to_win : WORDS_TO_WIN_VERSUS_MODE;
+}
+
+bool rules_versus_game_over(const VersusHangman* versus) {
+    return versus->player1.words_guessed_count >= rules_versus_words_to_win(versus) ||
+           versus->player2.words_guessed_count >= rules_versus_words_to_win(versus) ||
+           versus->overall_game_over_by_time;
+}
+
+// game_over al unui jucator inseamna aici doar sfarsitul rundei
+bool rules_versus_round_over(const VersusHangman* versus) {
+    return versus->player1.game_over || versus->player2.game_over;
+}
+
+static HangmanGame* rules_versus_player(VersusHangman* versus, CurrentPlayer player) {
+    return player == PLAYER_1 ? &versus->player1 : &versus->player2;
+}
+
+// Runda noua: jucatorii isi pastreaza dictionarul si, daca nu e joc nou, cuvintele ghicite si timpul ramas.
+static void rules_versus_reset_player(HangmanGame* player, const RulesEnv* env, bool full_game_reset) {
+    const Dictionary* dictionary = player->dictionary;
+    int words_guessed_count = full_game_reset ? 0 : player->words_guessed_count;
+    long time_left_ms = full_game_reset ? rules_balance(env)->initial_versus_mode_time_seconds * 1000L : player->time_left_ms;
+
+    memset(player, 0, sizeof(HangmanGame));
+    player->dictionary = dictionary;
+    player->words_guessed_count = words_guessed_count;
+    player->time_left_ms = time_left_ms;
+}
+
+static void rules_versus_pick_player_word(HangmanGame* player, int length, const RulesEnv* env) {
+    if (!rules_set_word(player, rules_pick_word(player->dictionary, length, env), false)) {
+        LOG_WARN(LOG_CAT_RULES, "rules_versus_reset: No words of length %d in new round.", length);
+        rules_set_word(player, "DEFAULT", false);
+    }
+}
+
+bool rules_versus_reset(VersusHangman* versus, const RulesEnv* env, bool full_game_reset) {
+    rules_versus_reset_player(&versus->player1, env, full_game_reset);
+    rules_versus_reset_player(&versus->player2, env, full_game_reset);
+    if (versus->player1.dictionary == NULL || versus->player2.dictionary == NULL) {
+        LOG_ERROR(LOG_CAT_RULES, "rules_versus_reset: Players have no word list.");
+        return false;
+    }
+    versus->overall_game_over_by_time = false;
+    if (full_game_reset || versus->words_to_win <= 0) {
+        versus->words_to_win = rules_balance(env)->words_to_win_versus_mode;
+    }
+
+    // lungime noua la fiecare runda, aceeasi pentru ambii jucatori, doar dintre lungimile existente
+    const WordIndex* index = &versus->player1.dictionary->index;
+    versus->common_word_length = word_index_random_length(index, VERSUS_MIN_WORD_LENGTH, VERSUS_MAX_WORD_LENGTH, env->rand(env->rand_data));
+    if (versus->common_word_length < 0) {
+        versus->common_word_length = word_index_random_length(index, 1, MAX_WORD_LENGTH, env->rand(env->rand_data));
+    }
+
+    rules_versus_pick_player_word(&versus->player1, versus->common_word_length, env);
+    rules_versus_pick_player_word(&versus->player2, versus->common_word_length, env);
+
+    versus->current_turn = (env->rand(env->rand_data) % 2 == 0) ? PLAYER_1 : PLAYER_2;
+    versus->round_over_display_time = 0;
+    rules_versus_player(versus, versus->current_turn)->start_time_ms = env->now_ms(env->clock_data);
+    return true;
+}
+
+RulesGuessResult rules_versus_guess(VersusHangman* versus, const RulesEnv* env, char letter) {
+    letter = rules_normalize_letter(letter);
+    if (letter == '\0' || rules_versus_game_over(versus) || rules_versus_round_over(versus)) {
+        return RULES_GUESS_IGNORED;
+    }
+    HangmanGame* active_player = rules_versus_player(versus, versus->current_turn);
+    HangmanGame* inactive_player = rules_versus_player(versus, versus->current_turn == PLAYER_1 ? PLAYER_2 : PLAYER_1);
+    int index = letter - 'A';
+    bool found_in_word = (active_player->word_letter_mask >> index) & 1u;
+    long now = env->now_ms(env->clock_data);
+
+    if (active_player->guessed_letters[index]) {
+        if (found_in_word) {
+            return RULES_GUESS_IGNORED;
+        }
+        active_player->wrong_guesses++; // o litera gresita repetata costa din nou
+    } else {
+        rules_reveal_letter(active_player, index);
+        if (found_in_word) {
+            active_player->time_left_ms += (rules_balance(env)->time_bonus_guess_seconds * 1000L);
+        } else {
+            active_player->wrong_guesses++;
+        }
+    }
+
+    if (rules_word_complete(active_player)) {
+        active_player->win = true;
+        active_player->words_guessed_count++;
+        active_player->wrong_guesses -= GUESS_BONUS_WORD_GUESSED;
+        if (active_player->wrong_guesses < 0) {
+            active_player->wrong_guesses = 0;
+        }
+        // premiu de consolare pentru adversar, care a pierdut runda
+        inactive_player->wrong_guesses -= GUESS_BONUS_ROUND_LOST;
+        if (inactive_player->wrong_guesses < 0) {
+            inactive_player->wrong_guesses = 0;
+        }
+        if (active_player->words_guessed_count < rules_versus_words_to_win(versus)) {
+            // sfarsit de runda: dupa pauza, rules_versus_reset(false) da cuvinte noi ambilor jucatori
+            versus->player1.game_over = true;
+            versus->player2.game_over = true;
+        }
+        versus->round_over_display_time = now;
+    } else if (active_player->wrong_guesses >= MAX_WRONG_GUESSES) {
+        // cine ramane fara incercari pierde tot jocul, fara schimbare de rand
+        active_player->win = false;
+        versus->overall_game_over_by_time = true;
+        versus->round_over_display_time = now;
+    } else if (!found_in_word) {
+        // randul se schimba doar la o greseala (inclusiv repetata)
+        active_player->time_left_ms -= (now - active_player->start_time_ms);
+        if (active_player->time_left_ms < 0) {
+            active_player->time_left_ms = 0;
+        }
+        versus->current_turn = (versus->current_turn == PLAYER_1) ? PLAYER_2 : PLAYER_1;
+        rules_versus_player(versus, versus->current_turn)->start_time_ms = now;
+    } else {
+        active_player->start_time_ms = now;
+    }
+    return found_in_word ? RULES_GUESS_HIT : RULES_GUESS_MISS;
+}
+
+void rules_versus_tick(VersusHangman* versus, const RulesEnv* env) {
+    if (rules_versus_game_over(versus) || rules_versus_round_over(versus)) {
+        return;
+    }
+    long now = env->now_ms(env->clock_data);
+    HangmanGame* player = rules_versus_player(versus, versus->current_turn);
+    player->time_left_ms -= now - player->start_time_ms;
+    player->start_time_ms = now;
+    if (player->time_left_ms <= 0) {
+        player->time_left_ms = 0;
+        player->game_over = true; // runda pierduta pe timp
+        player->win = false;
+        versus->overall_game_over_by_time = true;
+        versus->round_over_display_time = now;
+    }
+}
+
+// ---------------- env headless ----------------
+
+long rules_manual_clock(void* clock_data) {
+    return *(const long*)clock_data;
+}
+
+unsigned int rules_xorshift_rand(void* rand_data) {
+    uint32_t* state = (uint32_t*)rand_data;
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
@@ -0,0 +1,141 @@
+#ifndef __RULES__
+#define __RULES__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "dictionary.h"
+
+// Regulile jocului (normal, hard, versus) fara SDL: doar starea + functii de pas.
+// Ceasul si generatorul de numere aleatoare vin din RulesEnv, asa ca aceleasi reguli
+// ruleaza si in fereastra (SDL_GetTicks, word_index_rand) si headless (ceas simulat, xorshift pe fir).
+
+#define ALPHABET_SIZE 26
+#define MAX_WORD_LENGTH 30
+#define MAX_WRONG_GUESSES 6
+
+_Static_assert(MAX_WORD_LENGTH <= 32, "letter_positions tine o pozitie pe bit intr-un uint32_t");
+
+#define INITIAL_HARD_MODE_TIME_SECONDS 40
+#define TIME_BONUS_WIN_SECONDS 20
+#define INITIAL_WORD_LENGTH 3
+#define MAX_GAME_WORD_LENGTH 10
+#define WRONG_GUESS_BONUS_WIN 2
+#define NORMAL_START_DIFFICULTY_LEVEL 2 // cu scoruri (.scores): nivelul primului cuvant in normal mode, 0..DIFFICULTY_LEVELS-1
+#define ROUND_WIN_DISPLAY_DURATION 1500 // cat ramane "WORD GUESSED!" inainte de cuvantul urmator (ms)
+
+#define INITIAL_VERSUS_MODE_TIME_SECONDS 30
+#define TIME_BONUS_GUESS_SECONDS 15
+#define WORDS_TO_WIN_VERSUS_MODE 7
+#define GUESS_BONUS_WORD_GUESSED 4
+#define GUESS_BONUS_ROUND_LOST 2
+#define VERSUS_MIN_WORD_LENGTH 4
+#define VERSUS_MAX_WORD_LENGTH 10
+#define VERSUS_ROUND_OVER_DISPLAY_MS 1500 // pauza dintre runde
+#define VERSUS_GAME_OVER_DISPLAY_MS 3000  // dupa final, inputul e ignorat atat timp
+
+// Constantele de echilibru de mai sus ca valori, ca simularile (tools/tune.c) sa le poata varia fara recompilare.
+typedef struct RulesBalance {
+    int initial_hard_mode_time_seconds;
+    int time_bonus_win_seconds;
+    int wrong_guess_bonus_win;
+    int initial_versus_mode_time_seconds;
+    int time_bonus_guess_seconds;
+    int words_to_win_versus_mode;
+} RulesBalance;
+
+extern const RulesBalance rules_default_balance;   // exact #define-urile de mai sus
+
+typedef struct RulesEnv {
+    long (*now_ms)(void* clock_data);          // timp monoton in milisecunde
+    void* clock_data;
+    unsigned int (*rand)(void* rand_data);     // cel putin 30 de biti aleatori
+    void* rand_data;
+    const RulesBalance* balance;               // NULL = rules_default_balance
+} RulesEnv;
+
+typedef enum {
+    RULES_GUESS_IGNORED,   // nu e litera, litera deja incercata sau runda nu e activa
+    RULES_GUESS_HIT,
+    RULES_GUESS_MISS
+} RulesGuessResult;
+
+typedef struct HangmanGame {
+    char word[MAX_WORD_LENGTH + 1];
+    char displayed_word[MAX_WORD_LENGTH * 2 + 1]; //pt litera si space
+    bool guessed_letters[ALPHABET_SIZE];
+    // tabelele rundei, facute o data cand se alege cuvantul: o litera incercata e un test de bit,
+    // afisarea atinge doar pozitiile literei, iar castigul e (word_letter_mask & ~guessed_mask) == 0
+    uint32_t word_letter_mask;                 // bit i = litera 'A' + i apare in cuvant
+    uint32_t letter_positions[ALPHABET_SIZE];  // bit p = word[p] e litera 'A' + i
+    uint32_t guessed_mask;                     // guessed_letters ca masca
+    int word_length;
+    int wrong_guesses;
+    bool game_over;
+    bool win;
+    const Dictionary* dictionary; // imprumutat din dictionary_cache, read-only, nu se elibereaza aici
+    long start_time_ms;
+    long time_left_ms;
+    long current_round_time_limit_ms;
+    int current_word_length;
+    bool win_previous_round;
+    long round_won_display_time;
+    int words_guessed_count;
+    int difficulty_level;   // nivelul tinta (difficulty_index.h) in normal/hard, folosit doar daca dictionarul are scoruri
+} HangmanGame;
+
+// Enum to define which player's turn it is
+typedef enum {
+    PLAYER_1,
+    PLAYER_2
+} CurrentPlayer;
+
+// Struct to hold data for the versus mode
+typedef struct VersusHangman {
+    HangmanGame player1;
+    HangmanGame player2;
+    CurrentPlayer current_turn;
+    int common_word_length; // To ensure both players get words of the same length
+    long round_over_display_time; // To control how long game over/win messages are shown
+    bool overall_game_over_by_time; // overall game over for any reason (time or guesses)
+    int words_to_win; // din RulesBalance, fixat la jocul nou; 0 = WORDS_TO_WIN_VERSUS_MODE
+} VersusHangman;
+
+// length <= 0 = orice lungime; NULL daca nu exista cuvant potrivit
+const char* rules_pick_word(const Dictionary* dictionary, int length, const RulesEnv* env);
+// cuvant de nivelul de dificultate dat (sau cel mai apropiat) cu lungimea in [min_length, max_length];
+// dictionarele fara scoruri aleg doar dupa lungime
+const char* rules_pick_word_at_level(const Dictionary* dictionary, int level, int min_length, int max_length, const RulesEnv* env);
+bool rules_has_difficulty(const Dictionary* dictionary);
+bool rules_word_complete(const HangmanGame* hangman);
+
+// normal: cuvant oarecare, 6 greseli; cu scoruri, nivelul urca dupa un castig si coboara dupa o pierdere
+void rules_normal_init(HangmanGame* hangman);
+bool rules_normal_reset(HangmanGame* hangman, const RulesEnv* env);
+bool rules_normal_start(HangmanGame* hangman, const char* word);   // runda normala cu un cuvant dat (simulari)
+RulesGuessResult rules_normal_guess(HangmanGame* hangman, char letter);
+
+// hard: lungimea creste dupa fiecare cuvant ghicit, timp limita cu bonus; cu scoruri creste nivelul de
+// dificultate (DIFFICULTY_LEVELS runde), iar lungimea e oricare din INITIAL_WORD_LENGTH..MAX_GAME_WORD_LENGTH
+void rules_hard_init(HangmanGame* hangman, const RulesEnv* env);
+bool rules_hard_reset(HangmanGame* hangman, const RulesEnv* env);
+RulesGuessResult rules_hard_guess(HangmanGame* hangman, const RulesEnv* env, char letter);
+void rules_hard_tick(HangmanGame* hangman, const RulesEnv* env);
+
+// evil: cuvantul e ales de evil.c dupa fiecare litera, dintre cei ramasi posibili
+bool rules_evil_reset(HangmanGame* hangman, const char* word);
+void rules_evil_replace_word(HangmanGame* hangman, const char* word);
+
+// versus: doi jucatori pe rand, cuvinte de aceeasi lungime, timp separat pe jucator
+bool rules_versus_reset(VersusHangman* versus, const RulesEnv* env, bool full_game_reset);
+RulesGuessResult rules_versus_guess(VersusHangman* versus, const RulesEnv* env, char letter);
+void rules_versus_tick(VersusHangman* versus, const RulesEnv* env);
+bool rules_versus_game_over(const VersusHangman* versus);
+bool rules_versus_round_over(const VersusHangman* versus);
+int rules_versus_words_to_win(const VersusHangman* versus); // cuvintele jocului curent (RulesBalance)
+void rules_versus_update_displayed_word(HangmanGame* hangman);
+
+// RulesEnv pentru rulari headless: ceas manual (clock_data = long* in ms) si xorshift32 (rand_data = uint32_t* != 0)
+long rules_manual_clock(void* clock_data);
+unsigned int rules_xorshift_rand(void* rand_data);
+
+#endif // __RULES__
@@ -0,0 +1,137 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "solver.h"
+#include "log.h"
+
+#define SOLVER_ALL_LETTERS ((1u << ALPHABET_SIZE) - 1)
+
+static uint32_t solver_random(Solver* solver) {
+    uint32_t x = solver->rand_state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    solver->rand_state = x;
+    return x;
+}
+
+// baseline: o litera neincercata oarecare
+static int solver_random_letter(Solver* solver, const HangmanGame* hangman) {
+    uint32_t free_letters = ~hangman->guessed_mask & SOLVER_ALL_LETTERS;
+    int pick = (int)(solver_random(solver) % (uint32_t)__builtin_popcount(free_letters));
+    while (pick-- > 0) {
+        free_letters &= free_letters - 1;
+    }
+    return __builtin_ctz(free_letters);
+}
+
+// cea mai mare valoare dintre literele neincercate; la egalitate litera mai mica (determinist)
+static int solver_best_count(const int* counts, uint32_t guessed_mask) {
+    int best = -1;
+    for (int letter = 0; letter < ALPHABET_SIZE; letter++) {
+        if (!(guessed_mask & (1u << letter)) && (best < 0 || counts[letter] > counts[best])) {
+            best = letter;
+        }
+    }
+    return best;
+}
+
+// ordinea fixa a literelor dupa cate cuvinte de lungimea asta le contin, fara sa se uite la tabla
+static int solver_length_frequency_letter(Solver* solver, const HangmanGame* hangman) {
+    const PatternBucket* bucket = pattern_index_bucket(solver->patterns, hangman->word_length);
+    if (bucket == NULL) {
+        return solver_random_letter(solver, hangman);
+    }
+    int counts[ALPHABET_SIZE];
+    for (int letter = 0; letter < ALPHABET_SIZE; letter++) {
+        counts[letter] = pattern_bitset_count(pattern_bucket_letter_bits(bucket, letter), bucket->block_count);
+    }
+    return solver_best_count(counts, hangman->guessed_mask);
+}
+
+// litera continuta de cei mai multi candidati ramasi (probabilitatea de lovire)
+static int solver_candidate_frequency_letter(Solver* solver, const HangmanGame* hangman) {
+    solver->hint.active = true;
+    if (!hint_update(&solver->hint, hangman)) {
+        return solver_length_frequency_letter(solver, hangman);
+    }
+    const PatternBucket* bucket = solver->hint.bucket;
+    int counts[ALPHABET_SIZE];
+    for (int letter = 0; letter < ALPHABET_SIZE; letter++) {
+        counts[letter] = pattern_bitset_and_count(solver->hint.candidates, pattern_bucket_letter_bits(bucket, letter),
+                                                  bucket->block_count);
+    }
+    return solver_best_count(counts, hangman->guessed_mask);
+}
+
+// hint-ul din joc: castigul de informatie peste candidatii ramasi
+static int solver_entropy_letter(Solver* solver, const HangmanGame* hangman) {
+    int letter = hint_best_letter(&solver->hint, hangman);
+    return letter >= 0 ? letter : solver_length_frequency_letter(solver, hangman);
+}
+
+const SolverStrategy solver_strategies[] = {
+    {"entropy", "most informative letter over the matching words (the F1 hint)", solver_entropy_letter},
+    {"candidates", "letter found in most of the matching words", solver_candidate_frequency_letter},
+    {"frequency", "fixed order: letter found in most words of the length", solver_length_frequency_letter},
+    {"random", "any untried letter", solver_random_letter},
+};
+const int solver_strategy_count = (int)(sizeof(solver_strategies) / sizeof(solver_strategies[0]));
+
+const SolverStrategy* solver_strategy_find(const char* name) {
+    for (int i = 0; i < solver_strategy_count; i++) {
+        if (strcmp(solver_strategies[i].name, name) == 0) {
+            return &solver_strategies[i];
+        }
+    }
+    return NULL;
+}
+
+void solver_prepare_patterns(PatternIndex* patterns) {
+    const WordIndex* index = &patterns->dictionary->index;
+    for (int i = 0; i < index->available_count; i++) {
+        pattern_index_bucket(patterns, index->available_lengths[i]);
+    }
+}
+
+void solver_init(Solver* solver, const SolverStrategy* strategy, PatternIndex* patterns) {
+    memset(solver, 0, sizeof(Solver));
+    solver->strategy = strategy;
+    solver->patterns = patterns;
+    solver->rand_state = 1;
+    hint_init(&solver->hint, patterns);
+}
+
+void solver_free(Solver* solver) {
+    if (solver == NULL) {
+        return;
+    }
+    hint_free(&solver->hint);
+    memset(solver, 0, sizeof(Solver));
+}
+
+SolverResult solver_play_word(Solver* solver, HangmanGame* hangman, const char* word, uint32_t seed, char* trace) {
+    SolverResult result = {false, 0, 0, 0};
+    solver->rand_state = seed ? seed : 1;
+    if (!rules_normal_start(hangman, word)) {
+        return result;
+    }
+    while (!rules_word_complete(hangman) && hangman->guessed_mask != SOLVER_ALL_LETTERS) {
+        bool blunder = solver->blunder_percent > 0 && (int)(solver_random(solver) % 100) < solver->blunder_percent;
+        int letter = blunder ? solver_random_letter(solver, hangman) : solver->strategy->next_letter(solver, hangman);
+        // dupa a MAX_WRONG_GUESSES-a greseala partida e pierduta; se joaca mai departe in afara regulilor
+        // doar ca sa se stie cat de departe era cuvantul (misses_to_solve)
+        hangman->game_over = false;
+        if (rules_normal_guess(hangman, (char)('A' + letter)) == RULES_GUESS_MISS) {
+            result.misses_to_solve++;
+        }
+        if (trace) {
+            trace[result.guesses] = (char)('A' + letter);
+        }
+        result.guesses++;
+    }
+    result.win = result.misses_to_solve < MAX_WRONG_GUESSES;
+    result.wrong_guesses = result.win ? result.misses_to_solve : MAX_WRONG_GUESSES;
+    return result;
+}
@@ -0,0 +1,52 @@
+#ifndef __SOLVER__
+#define __SOLVER__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "rules.h"
+#include "pattern_index.h"
+#include "hint.h"
+
+// Jucatori automati pentru rulari headless (tools/solve.c): o strategie alege litera urmatoare doar din
+// ce vede jucatorul (displayed_word + literele incercate), niciodata din cuvantul secret.
+// Un Solver e starea unui fir; mai multe fire pot juca in paralel peste acelasi PatternIndex
+// daca bucket-urile lungimilor folosite au fost construite inainte (solver_prepare_patterns).
+
+typedef struct Solver Solver;
+
+typedef struct SolverStrategy {
+    const char* name;
+    const char* description;
+    int (*next_letter)(Solver* solver, const HangmanGame* hangman);   // 0..25, o litera neincercata
+} SolverStrategy;
+
+struct Solver {
+    const SolverStrategy* strategy;
+    PatternIndex* patterns;     // imprumutat, read-only
+    HintState hint;             // candidatii ramasi, pentru strategiile care se uita la dictionar
+    uint32_t rand_state;
+    int blunder_percent;        // 0..100: cat de des joaca o litera neincercata oarecare in locul strategiei
+};
+
+typedef struct SolverResult {
+    bool win;
+    int wrong_guesses;      // ca in joc, cel mult MAX_WRONG_GUESSES
+    int misses_to_solve;    // ratari pana la cuvantul complet, jucand si dupa pierdere
+    int guesses;            // litere incercate pana la cuvantul complet
+} SolverResult;
+
+extern const SolverStrategy solver_strategies[];
+extern const int solver_strategy_count;
+
+const SolverStrategy* solver_strategy_find(const char* name);   // NULL daca nu exista
+// construieste toate bucket-urile (pe firul apelant), ca indexul sa poata fi citit din mai multe fire
+void solver_prepare_patterns(PatternIndex* patterns);
+
+void solver_init(Solver* solver, const SolverStrategy* strategy, PatternIndex* patterns);
+void solver_free(Solver* solver);
+// joaca un cuvant dupa regulile din normal mode; seed face strategiile aleatoare reproductibile
+// (acelasi cuvant si seed = aceeasi partida, pe orice fir). trace, daca nu e NULL, primeste literele
+// incercate, in ordine ('A'-'Z', cel mult ALPHABET_SIZE), ca partida sa poata fi rejucata pe alte reguli.
+SolverResult solver_play_word(Solver* solver, HangmanGame* hangman, const char* word, uint32_t seed, char* trace);
+
+#endif // __SOLVER__
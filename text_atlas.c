@@ -0,0 +1,244 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+
+#include "text_atlas.h"
+#include "perf.h"
+#include "log.h"
+
+// cate glyph-uri se trimit la GPU intr-un singur apel de desenare
+#define TEXT_ATLAS_BATCH_GLYPHS 128
+
+static TextAtlas atlas_cache[TEXT_ATLAS_CACHE_SIZE];
+static int atlas_cache_count = 0;
+
+bool text_atlas_build(TextAtlas* atlas, SDL_Renderer* renderer, TTF_Font* font) {
+    if (atlas == NULL || renderer == NULL || font == NULL) {
+        LOG_ERROR(LOG_CAT_RENDER, "text_atlas_build: Invalid atlas, renderer or font.");
+        return false;
+    }
+    memset(atlas, 0, sizeof(TextAtlas));
+
+    SDL_Color white = {255, 255, 255, 255}; // culoarea se aplica la desenare prin vertex color
+    SDL_Surface* glyph_surfaces[TEXT_ATLAS_GLYPH_COUNT] = {0};
+
+    // se rasterizeaza fiecare glyph si se aranjeaza pe randuri (shelf packing)
+    int pen_x = 0;
+    int pen_y = 0;
+    int row_height = 0;
+    for (int i = 0; i < TEXT_ATLAS_GLYPH_COUNT; i++) {
+        Uint16 ch = (Uint16)(TEXT_ATLAS_FIRST_CHAR + i);
+        int advance = 0;
+        if (TTF_GlyphMetrics(font, ch, NULL, NULL, NULL, NULL, &advance) < 0) {
+            advance = 0;
+        }
+        atlas->glyphs[i].advance = advance;
+
+        glyph_surfaces[i] = TTF_RenderGlyph_Blended(font, ch, white);
+        perf_count(PERF_COUNTER_TEXT_RASTER, 1);
+        if (!glyph_surfaces[i]) {
+            continue; // spatiul sau glyph-urile lipsa nu au suprafata, doar advance
+        }
+        int w = glyph_surfaces[i]->w;
+        int h = glyph_surfaces[i]->h;
+        if (pen_x + w > TEXT_ATLAS_WIDTH) {
+            pen_x = 0;
+            pen_y += row_height + 1;
+            row_height = 0;
+        }
+        atlas->glyphs[i].src = (SDL_Rect){pen_x, pen_y, w, h};
+        pen_x += w + 1; // 1px intre glyph-uri ca sa nu se amestece la filtrare
+        if (h > row_height) {
+            row_height = h;
+        }
+    }
+    atlas->texture_w = TEXT_ATLAS_WIDTH;
+    atlas->texture_h = pen_y + row_height;
+    if (atlas->texture_h <= 0) {
+        atlas->texture_h = 1;
+    }
+
+    SDL_Surface* sheet = SDL_CreateRGBSurfaceWithFormat(0, atlas->texture_w, atlas->texture_h, 32, SDL_PIXELFORMAT_RGBA32);
+    if (!sheet) {
+        LOG_ERROR(LOG_CAT_RENDER, "text_atlas_build: Failed to create atlas surface: %s", SDL_GetError());
+        for (int i = 0; i < TEXT_ATLAS_GLYPH_COUNT; i++) {
+            if (glyph_surfaces[i]) SDL_FreeSurface(glyph_surfaces[i]);
+        }
+        return false;
+    }
+    SDL_FillRect(sheet, NULL, 0);
+
+    for (int i = 0; i < TEXT_ATLAS_GLYPH_COUNT; i++) {
+        if (!glyph_surfaces[i]) {
+            continue;
+        }
+        SDL_SetSurfaceBlendMode(glyph_surfaces[i], SDL_BLENDMODE_NONE); // se copiaza si canalul alpha
+        SDL_Rect dst = atlas->glyphs[i].src;
+        SDL_BlitSurface(glyph_surfaces[i], NULL, sheet, &dst);
+        SDL_FreeSurface(glyph_surfaces[i]);
+    }
+
+    atlas->texture = SDL_CreateTextureFromSurface(renderer, sheet);
+    perf_count(PERF_COUNTER_TEXTURE_CREATE, 1);
+    SDL_FreeSurface(sheet);
+    if (!atlas->texture) {
+        LOG_ERROR(LOG_CAT_RENDER, "text_atlas_build: Failed to create atlas texture: %s", SDL_GetError());
+        return false;
+    }
+    SDL_SetTextureBlendMode(atlas->texture, SDL_BLENDMODE_BLEND);
+
+    atlas->renderer = renderer;
+    atlas->font = font;
+    return true;
+}
+
+void text_atlas_destroy(TextAtlas* atlas) {
+    if (atlas == NULL) {
+        return;
+    }
+    if (atlas->texture) {
+        SDL_DestroyTexture(atlas->texture);
+        atlas->texture = NULL;
+    }
+    atlas->renderer = NULL;
+    atlas->font = NULL;
+}
+
+bool text_atlas_supports(const char* text) {
+    for (const unsigned char* p = (const unsigned char*)text; *p; p++) {
+        if (*p < TEXT_ATLAS_FIRST_CHAR || *p > TEXT_ATLAS_LAST_CHAR) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static int text_atlas_kerning(const TextAtlas* atlas, unsigned char previous, unsigned char current) {
+#if SDL_TTF_VERSION_ATLEAST(2, 0, 14)
+    if (previous == 0) {
+        return 0;
+    }
+    return TTF_GetFontKerningSizeGlyphs(atlas->font, previous, current);
+#else
+    (void)atlas;
+    (void)previous;
+    (void)current;
+    return 0;
+#endif
+}
+
+int text_atlas_measure(const TextAtlas* atlas, const char* text) {
+    if (atlas == NULL || text == NULL) {
+        return 0;
+    }
+    int width = 0;
+    unsigned char previous = 0;
+    for (const unsigned char* p = (const unsigned char*)text; *p; p++) {
+        if (*p < TEXT_ATLAS_FIRST_CHAR || *p > TEXT_ATLAS_LAST_CHAR) {
+            continue;
+        }
+        width += text_atlas_kerning(atlas, previous, *p);
+        width += atlas->glyphs[*p - TEXT_ATLAS_FIRST_CHAR].advance;
+        previous = *p;
+    }
+    return width;
+}
+
+void text_atlas_draw(const TextAtlas* atlas, const char* text, SDL_Color color, int x, int y) {
+    if (atlas == NULL || atlas->texture == NULL || text == NULL) {
+        return;
+    }
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    // toate glyph-urile textului sunt trimise ca quad-uri intr-un singur SDL_RenderGeometry
+    SDL_Vertex vertices[TEXT_ATLAS_BATCH_GLYPHS * 4];
+    int indices[TEXT_ATLAS_BATCH_GLYPHS * 6];
+    int glyph_count = 0;
+    float inv_w = 1.0f / (float)atlas->texture_w;
+    float inv_h = 1.0f / (float)atlas->texture_h;
+#else
+    SDL_SetTextureColorMod(atlas->texture, color.r, color.g, color.b);
+    SDL_SetTextureAlphaMod(atlas->texture, color.a);
+#endif
+
+    int pen_x = x;
+    unsigned char previous = 0;
+    for (const unsigned char* p = (const unsigned char*)text; *p; p++) {
+        if (*p < TEXT_ATLAS_FIRST_CHAR || *p > TEXT_ATLAS_LAST_CHAR) {
+            continue;
+        }
+        const TextGlyph* glyph = &atlas->glyphs[*p - TEXT_ATLAS_FIRST_CHAR];
+        pen_x += text_atlas_kerning(atlas, previous, *p);
+        previous = *p;
+
+        if (glyph->src.w > 0 && glyph->src.h > 0) {
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+            if (glyph_count == TEXT_ATLAS_BATCH_GLYPHS) {
+                SDL_RenderGeometry(atlas->renderer, atlas->texture, vertices, glyph_count * 4, indices, glyph_count * 6);
+                glyph_count = 0;
+            }
+            float x0 = (float)pen_x;
+            float y0 = (float)y;
+            float x1 = x0 + glyph->src.w;
+            float y1 = y0 + glyph->src.h;
+            float u0 = glyph->src.x * inv_w;
+            float v0 = glyph->src.y * inv_h;
+            float u1 = (glyph->src.x + glyph->src.w) * inv_w;
+            float v1 = (glyph->src.y + glyph->src.h) * inv_h;
+
+            SDL_Vertex* v = &vertices[glyph_count * 4];
+            v[0] = (SDL_Vertex){{x0, y0}, color, {u0, v0}};
+            v[1] = (SDL_Vertex){{x1, y0}, color, {u1, v0}};
+            v[2] = (SDL_Vertex){{x1, y1}, color, {u1, v1}};
+            v[3] = (SDL_Vertex){{x0, y1}, color, {u0, v1}};
+
+            int base = glyph_count * 4;
+            int* idx = &indices[glyph_count * 6];
+            idx[0] = base;
+            idx[1] = base + 1;
+            idx[2] = base + 2;
+            idx[3] = base;
+            idx[4] = base + 2;
+            idx[5] = base + 3;
+            glyph_count++;
+#else
+            SDL_Rect dst = {pen_x, y, glyph->src.w, glyph->src.h};
+            SDL_RenderCopy(atlas->renderer, atlas->texture, &glyph->src, &dst);
+#endif
+        }
+        pen_x += glyph->advance;
+    }
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    if (glyph_count > 0) {
+        SDL_RenderGeometry(atlas->renderer, atlas->texture, vertices, glyph_count * 4, indices, glyph_count * 6);
+    }
+#endif
+}
+
+TextAtlas* text_atlas_get(SDL_Renderer* renderer, TTF_Font* font) {
+    if (renderer == NULL || font == NULL) {
+        return NULL;
+    }
+    for (int i = 0; i < atlas_cache_count; i++) {
+        if (atlas_cache[i].renderer == renderer && atlas_cache[i].font == font) {
+            return &atlas_cache[i];
+        }
+    }
+    if (atlas_cache_count == TEXT_ATLAS_CACHE_SIZE) {
+        LOG_WARN(LOG_CAT_RENDER, "text_atlas_get: Atlas cache is full, text will be rasterized per call.");
+        return NULL;
+    }
+    if (!text_atlas_build(&atlas_cache[atlas_cache_count], renderer, font)) {
+        return NULL;
+    }
+    return &atlas_cache[atlas_cache_count++];
+}
+
+void text_atlas_cache_clear(void) {
+    for (int i = 0; i < atlas_cache_count; i++) {
+        text_atlas_destroy(&atlas_cache[i]);
+    }
+    atlas_cache_count = 0;
+}
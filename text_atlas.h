@@ -0,0 +1,39 @@
+#ifndef __TEXT_ATLAS__
+#define __TEXT_ATLAS__
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+#include <stdbool.h>
+
+// caracterele ASCII printabile, rasterizate o singura data intr-o textura
+#define TEXT_ATLAS_FIRST_CHAR 32
+#define TEXT_ATLAS_LAST_CHAR 126
+#define TEXT_ATLAS_GLYPH_COUNT (TEXT_ATLAS_LAST_CHAR - TEXT_ATLAS_FIRST_CHAR + 1)
+#define TEXT_ATLAS_WIDTH 512
+#define TEXT_ATLAS_CACHE_SIZE 4
+
+typedef struct TextGlyph {
+    SDL_Rect src;   // pozitia glyph-ului in textura atlasului
+    int advance;    // cat se muta cursorul dupa glyph
+} TextGlyph;
+
+typedef struct TextAtlas {
+    SDL_Renderer* renderer;
+    TTF_Font* font;
+    SDL_Texture* texture;
+    int texture_w;
+    int texture_h;
+    TextGlyph glyphs[TEXT_ATLAS_GLYPH_COUNT];
+} TextAtlas;
+
+bool text_atlas_build(TextAtlas* atlas, SDL_Renderer* renderer, TTF_Font* font);
+void text_atlas_destroy(TextAtlas* atlas);
+bool text_atlas_supports(const char* text);
+int text_atlas_measure(const TextAtlas* atlas, const char* text);
+void text_atlas_draw(const TextAtlas* atlas, const char* text, SDL_Color color, int x, int y);
+
+// atlasele sunt tinute intr-un cache mic, cheia e perechea renderer + font
+TextAtlas* text_atlas_get(SDL_Renderer* renderer, TTF_Font* font);
+void text_atlas_cache_clear(void);
+
+#endif // __TEXT_ATLAS__
@@ -0,0 +1,622 @@
+// bench.c - microbenchmark pentru caile fierbinti ale jocului
+//
+//   hangman_bench [--words 1000,100000,1000000] [--min-time-ms 200] [--font fonts/...ttf] [--verbose]
+//
+// Randarea ruleaza pe driverul video SDL "dummy" (SDL_VIDEODRIVER=offscreen il inlocuieste), fara fereastra.
+// Pentru fiecare marime de dictionar (1k..10M cuvinte) se genereaza o lista sintetica, mereu aceeasi,
+// intr-un director temporar, si se raporteaza ns/op, allocs/op si ops/s (MB/s pentru incarcari).
+// allocs/op numara malloc/calloc/realloc din codul jocului (doar cand e linkat cu --wrap, vezi CMakeLists.txt)
+// plus tot ce trece prin SDL_malloc (SDL, SDL_ttf).
+//
+// Build: cmake -S . -B build && cmake --build build --target hangman_bench
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+
+#include "interface.h"
+#include "normal_mode.h"
+#include "hard_mode.h"
+#include "versus_mode.h"
+#include "evil_mode.h"
+#include "dictionary_cache.h"
+#include "rules.h"
+#include "gallows.h"
+#include "pattern_index.h"
+#include "hint.h"
+
+#define BENCH_DEFAULT_FONT "fonts/Freckle_Face/FreckleFace-Regular.ttf"
+#define BENCH_MAX_SIZES 16
+#define BENCH_MAX_ITERATIONS 1000000000L
+
+// ---------------- numararea alocarilor ----------------
+
+static unsigned long long bench_allocs;
+
+#ifdef BENCH_WRAP_MALLOC
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+void __real_free(void* ptr);
+
+void* __wrap_malloc(size_t size) {
+    bench_allocs++;
+    return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t count, size_t size) {
+    bench_allocs++;
+    return __real_calloc(count, size);
+}
+
+void* __wrap_realloc(void* ptr, size_t size) {
+    bench_allocs++;
+    return __real_realloc(ptr, size);
+}
+
+void __wrap_free(void* ptr) {
+    __real_free(ptr);
+}
+#endif
+
+static SDL_malloc_func sdl_malloc_original;
+static SDL_calloc_func sdl_calloc_original;
+static SDL_realloc_func sdl_realloc_original;
+static SDL_free_func sdl_free_original;
+
+static void* SDLCALL bench_sdl_malloc(size_t size) {
+    bench_allocs++;
+    return sdl_malloc_original(size);
+}
+
+static void* SDLCALL bench_sdl_calloc(size_t count, size_t size) {
+    bench_allocs++;
+    return sdl_calloc_original(count, size);
+}
+
+static void* SDLCALL bench_sdl_realloc(void* ptr, size_t size) {
+    bench_allocs++;
+    return sdl_realloc_original(ptr, size);
+}
+
+static void SDLCALL bench_sdl_free(void* ptr) {
+    sdl_free_original(ptr);
+}
+
+// ---------------- runner ----------------
+
+typedef void (*BenchFn)(void* ctx, long iterations);
+
+static double bench_min_time_s = 0.2;
+
+// Dubleaza numarul de iteratii pana cand o rulare tine cel putin bench_min_time_s; se raporteaza ultima rulare.
+static void bench_run(const char* name, int words, BenchFn fn, void* ctx, double bytes_per_op) {
+    Uint64 frequency = SDL_GetPerformanceFrequency();
+    long iterations = 1;
+    double seconds = 0.0;
+    unsigned long long allocs = 0;
+    for (;;) {
+        unsigned long long allocs_before = bench_allocs;
+        Uint64 start = SDL_GetPerformanceCounter();
+        fn(ctx, iterations);
+        seconds = (double)(SDL_GetPerformanceCounter() - start) / (double)frequency;
+        allocs = bench_allocs - allocs_before;
+        if (seconds >= bench_min_time_s || iterations >= BENCH_MAX_ITERATIONS) {
+            break;
+        }
+        // tinta cu 20% peste timpul minim, dar cel mult x100 pe pas
+        double scale = (seconds > 0.0) ? (bench_min_time_s * 1.2 / seconds) : 100.0;
+        if (scale > 100.0) scale = 100.0;
+        if (scale < 2.0) scale = 2.0;
+        iterations = (long)(iterations * scale);
+    }
+
+    char words_str[16] = "-";
+    if (words > 0) {
+        snprintf(words_str, sizeof(words_str), "%d", words);
+    }
+    char mb_str[16] = "-";
+    if (bytes_per_op > 0.0) {
+        snprintf(mb_str, sizeof(mb_str), "%.1f", bytes_per_op * iterations / seconds / 1e6);
+    }
+    printf("%-44s %9s %12.1f %10.2f %14.0f %9s\n", name, words_str, seconds * 1e9 / iterations,
+           (double)allocs / iterations, iterations / seconds, mb_str);
+    fflush(stdout);
+}
+
+// ---------------- dictionar sintetic ----------------
+
+// frecventa aproximativa a literelor in engleza, ca distributia literelor din cuvinte sa fie realista
+static const char bench_letters[] =
+    "EEEEEEEEEEEETTTTTTTTTAAAAAAAAOOOOOOOIIIIIIINNNNNNNSSSSSSHHHHHHRRRRRRDDDDLLLLCCCUUUMMMWWFFGGYYPPBVKJXQZ";
+
+static uint32_t bench_rng = 2463534242u;
+
+static bool bench_write_dictionary(const char* filename, int words, long* file_size) {
+    FILE* file = fopen(filename, "wb");
+    if (!file) {
+        fprintf(stderr, "ERROR: bench_write_dictionary: Cannot create %s\n", filename);
+        return false;
+    }
+    static char buffer[1 << 16];
+    setvbuf(file, buffer, _IOFBF, sizeof(buffer));
+    bench_rng = 2463534242u;
+    char word[16];
+    for (int i = 0; i < words; i++) {
+        int length = 3 + (int)(rules_xorshift_rand(&bench_rng) % 12); // 3..14 litere
+        for (int k = 0; k < length; k++) {
+            word[k] = bench_letters[rules_xorshift_rand(&bench_rng) % (sizeof(bench_letters) - 1)];
+        }
+        word[length] = '\n';
+        fwrite(word, 1, (size_t)length + 1, file);
+    }
+    *file_size = ftell(file);
+    fclose(file);
+    return true;
+}
+
+// ---------------- benchmark-uri pe dictionar ----------------
+
+typedef struct BenchDictContext {
+    Game game;
+    const Dictionary* dictionary;
+    HangmanGame hangman;
+    long now_ms;
+    uint32_t rand_state;
+    RulesEnv env;     // ceas manual + xorshift, ca rezultatele sa nu depinda de SDL_GetTicks
+    int letter;
+    PatternIndex patterns;
+    const PatternBucket* bucket;   // lungimea cu cele mai multe cuvinte
+    uint64_t* candidates;
+    HintState hint;
+} BenchDictContext;
+
+static const char bench_guess_order[] = "ETAOINSHRDLCUMWFGYPBVKJXQZ";
+
+static char bench_next_letter(BenchDictContext* ctx) {
+    char letter = bench_guess_order[ctx->letter];
+    ctx->letter = (ctx->letter + 1) % ALPHABET_SIZE;
+    return letter;
+}
+
+static void bench_load_text(void* data, long iterations) {
+    (void)data;
+    for (long i = 0; i < iterations; i++) {
+        Dictionary dict;
+        if (dictionary_load_text(&dict, dictionary_cache_filename(LANG_ENGLISH))) {
+            dictionary_free(&dict);
+        }
+    }
+}
+
+static void bench_load_binary(void* data, long iterations) {
+    (void)data;
+    for (long i = 0; i < iterations; i++) {
+        Dictionary dict;
+        if (dictionary_load_binary(&dict, dictionary_cache_binary_filename(LANG_ENGLISH))) {
+            dictionary_free(&dict);
+        }
+    }
+}
+
+// cache golit la fiecare iteratie: exact ce face primul mod de joc pornit dupa schimbarea limbii
+static void bench_load_words_cold(void* data, long iterations) {
+    BenchDictContext* ctx = (BenchDictContext*)data;
+    for (long i = 0; i < iterations; i++) {
+        dictionary_cache_shutdown();
+        normal_mode_load_words_from_file(&ctx->hangman, LANG_ENGLISH);
+        normal_mode_release_words(&ctx->hangman);
+    }
+}
+
+static void bench_load_words_cached(void* data, long iterations) {
+    BenchDictContext* ctx = (BenchDictContext*)data;
+    for (long i = 0; i < iterations; i++) {
+        normal_mode_load_words_from_file(&ctx->hangman, LANG_ENGLISH);
+        normal_mode_release_words(&ctx->hangman);
+    }
+}
+
+static void bench_pick_any(void* data, long iterations) {
+    BenchDictContext* ctx = (BenchDictContext*)data;
+    for (long i = 0; i < iterations; i++) {
+        rules_pick_word(ctx->dictionary, 0, &ctx->env);
+    }
+}
+
+static void bench_pick_by_length(void* data, long iterations) {
+    BenchDictContext* ctx = (BenchDictContext*)data;
+    const WordIndex* index = &ctx->dictionary->index;
+    for (long i = 0; i < iterations; i++) {
+        rules_pick_word(ctx->dictionary, index->available_lengths[i % index->available_count], &ctx->env);
+    }
+}
+
+static void bench_random_length(void* data, long iterations) {
+    BenchDictContext* ctx = (BenchDictContext*)data;
+    for (long i = 0; i < iterations; i++) {
+        word_index_random_length(&ctx->dictionary->index, VERSUS_MIN_WORD_LENGTH, VERSUS_MAX_WORD_LENGTH,
+                                 rules_xorshift_rand(&ctx->rand_state));
+    }
+}
+
+// o tasta pe iteratie; dupa game over urmatoarea tasta porneste jocul nou (ca in joc)
+static void bench_normal_process_key(void* data, long iterations) {
+    BenchDictContext* ctx = (BenchDictContext*)data;
+    for (long i = 0; i < iterations; i++) {
+        normal_mode_process_key(&ctx->game, bench_next_letter(ctx));
+    }
+}
+
+// fiecare litera repartitioneaza candidatii; dupa game over tasta urmatoare incepe alt joc (toata lungimea)
+static void bench_evil_process_key(void* data, long iterations) {
+    BenchDictContext* ctx = (BenchDictContext*)data;
+    for (long i = 0; i < iterations; i++) {
+        evil_mode_process_key(&ctx->game, bench_next_letter(ctx));
+    }
+}
+
+static void bench_hard_process_key(void* data, long iterations) {
+    BenchDictContext* ctx = (BenchDictContext*)data;
+    for (long i = 0; i < iterations; i++) {
+        ctx->now_ms += 250;
+        rules_hard_tick(ctx->game.hangman, &ctx->game.rules_env);
+        hard_mode_process_key(&ctx->game, bench_next_letter(ctx));
+    }
+}
+
+static void bench_versus_process_key(void* data, long iterations) {
+    BenchDictContext* ctx = (BenchDictContext*)data;
+    for (long i = 0; i < iterations; i++) {
+        ctx->now_ms += 250;
+        if (rules_versus_game_over(ctx->game.versus_data)) {
+            versus_mode_reset(&ctx->game, true);
+        } else if (rules_versus_round_over(ctx->game.versus_data)) {
+            versus_mode_reset(&ctx->game, false);
+        } else {
+            versus_mode_process_key(&ctx->game, bench_next_letter(ctx));
+        }
+    }
+}
+
+static void bench_rules_normal_guess(void* data, long iterations) {
+    BenchDictContext* ctx = (BenchDictContext*)data;
+    for (long i = 0; i < iterations; i++) {
+        if (ctx->hangman.game_over) {
+            rules_normal_reset(&ctx->hangman, &ctx->env);
+        }
+        rules_normal_guess(&ctx->hangman, bench_next_letter(ctx));
+    }
+}
+
+static void bench_update_displayed_word(void* data, long iterations) {
+    BenchDictContext* ctx = (BenchDictContext*)data;
+    for (long i = 0; i < iterations; i++) {
+        ctx->hangman.guessed_letters[i % ALPHABET_SIZE] = !ctx->hangman.guessed_letters[i % ALPHABET_SIZE];
+        rules_versus_update_displayed_word(&ctx->hangman);
+    }
+}
+
+// prima trecere: bucket-ul se construieste (o data pe lungime, la primul hint)
+static void bench_pattern_build(void* data, long iterations) {
+    BenchDictContext* ctx = (BenchDictContext*)data;
+    int length = ctx->bucket->length;
+    for (long i = 0; i < iterations; i++) {
+        pattern_index_free(&ctx->patterns);
+        pattern_index_init(&ctx->patterns, ctx->dictionary);
+        ctx->bucket = pattern_index_bucket(&ctx->patterns, length);
+    }
+}
+
+// S___E fara A/R/T: doua pozitii descoperite, trei litere excluse
+static void bench_pattern_query(void* data, long iterations) {
+    BenchDictContext* ctx = (BenchDictContext*)data;
+    char pattern[WORD_INDEX_MAX_LENGTH + 1];
+    memset(pattern, '_', sizeof(pattern));
+    pattern[0] = 'S';
+    pattern[ctx->bucket->length - 1] = 'E';
+    uint32_t excluded = (1u << ('A' - 'A')) | (1u << ('R' - 'A')) | (1u << ('T' - 'A'));
+    for (long i = 0; i < iterations; i++) {
+        pattern_bucket_query(ctx->bucket, pattern, excluded, ctx->candidates);
+    }
+}
+
+static void bench_pattern_letter_counts(void* data, long iterations) {
+    BenchDictContext* ctx = (BenchDictContext*)data;
+    for (long i = 0; i < iterations; i++) {
+        for (int letter = 0; letter < PATTERN_ALPHABET_SIZE; letter++) {
+            pattern_bitset_and_count(ctx->candidates, pattern_bucket_letter_bits(ctx->bucket, letter), ctx->bucket->block_count);
+        }
+    }
+}
+
+// un joc intreg jucat doar cu hint-uri: fiecare op = un hint + litera lui + filtrarea incrementala
+static void bench_hint_guess(void* data, long iterations) {
+    BenchDictContext* ctx = (BenchDictContext*)data;
+    for (long i = 0; i < iterations; i++) {
+        if (ctx->hangman.game_over) {
+            rules_normal_reset(&ctx->hangman, &ctx->env);
+        }
+        int letter = hint_best_letter(&ctx->hint, &ctx->hangman);
+        if (letter < 0) {
+            rules_normal_reset(&ctx->hangman, &ctx->env);
+            continue;
+        }
+        rules_normal_guess(&ctx->hangman, (char)('A' + letter));
+        hint_update(&ctx->hint, &ctx->hangman);
+    }
+}
+
+static void bench_patterns(BenchDictContext* ctx, int words) {
+    const WordIndex* index = &ctx->dictionary->index;
+    int length = index->available_lengths[0];
+    for (int i = 1; i < index->available_count; i++) {
+        if (word_index_count_of_length(index, index->available_lengths[i]) > word_index_count_of_length(index, length)) {
+            length = index->available_lengths[i];
+        }
+    }
+    pattern_index_init(&ctx->patterns, ctx->dictionary);
+    ctx->bucket = pattern_index_bucket(&ctx->patterns, length);
+    if (ctx->bucket) {
+        ctx->candidates = (uint64_t*)malloc((size_t)ctx->bucket->block_count * sizeof(uint64_t));
+    }
+    if (ctx->candidates) {
+        bench_run("pattern_index_bucket (build)", words, bench_pattern_build, ctx, 0.0);
+        bench_run("pattern_bucket_query", words, bench_pattern_query, ctx, 0.0);
+        bench_run("pattern_bitset_and_count x26", words, bench_pattern_letter_counts, ctx, 0.0);
+    }
+    hint_init(&ctx->hint, &ctx->patterns);
+    rules_normal_reset(&ctx->hangman, &ctx->env);
+    bench_run("hint_best_letter + guess", words, bench_hint_guess, ctx, 0.0);
+    hint_free(&ctx->hint);
+    free(ctx->candidates);
+    ctx->candidates = NULL;
+    pattern_index_free(&ctx->patterns);
+}
+
+static void bench_dictionary(int words, bool verbose) {
+    long file_size = 0;
+    if (!bench_write_dictionary(dictionary_cache_filename(LANG_ENGLISH), words, &file_size)) {
+        return;
+    }
+
+    BenchDictContext* ctx = (BenchDictContext*)calloc(1, sizeof(BenchDictContext));
+    if (!ctx) {
+        return;
+    }
+    ctx->rand_state = 88172645u;
+    ctx->env = (RulesEnv){rules_manual_clock, &ctx->now_ms, rules_xorshift_rand, &ctx->rand_state, NULL};
+    ctx->game.current_state = NORMAL_MODE;
+    ctx->game.current_language = LANG_ENGLISH;
+    ctx->game.rules_env = ctx->env;
+
+    // fara .bin: jocul citeste words_en.txt
+    remove(dictionary_cache_binary_filename(LANG_ENGLISH));
+    bench_run("dictionary_load_text", words, bench_load_text, ctx, (double)file_size);
+    bench_run("normal_mode_load_words_from_file (.txt)", words, bench_load_words_cold, ctx, (double)file_size);
+
+    Dictionary dict;
+    if (!dictionary_load_text(&dict, dictionary_cache_filename(LANG_ENGLISH)) ||
+        !dictionary_write_binary(&dict, dictionary_cache_binary_filename(LANG_ENGLISH))) {
+        fprintf(stderr, "ERROR: bench_dictionary: Cannot build %s\n", dictionary_cache_binary_filename(LANG_ENGLISH));
+        free(ctx);
+        return;
+    }
+    dictionary_free(&dict);
+    bench_run("dictionary_load_binary", words, bench_load_binary, ctx, 0.0);
+    bench_run("normal_mode_load_words_from_file (.bin)", words, bench_load_words_cold, ctx, 0.0);
+    bench_run("normal_mode_load_words_from_file (cached)", words, bench_load_words_cached, ctx, 0.0);
+
+    ctx->dictionary = dictionary_cache_acquire(LANG_ENGLISH);
+    if (ctx->dictionary == NULL) {
+        free(ctx);
+        return;
+    }
+    if (verbose) {
+        fprintf(stdout, "# %d words, %d lengths, %.1f MB text\n", ctx->dictionary->word_count,
+                ctx->dictionary->index.available_count, file_size / 1e6);
+    }
+    bench_run("rules_pick_word (any length)", words, bench_pick_any, ctx, 0.0);
+    bench_run("rules_pick_word (by length)", words, bench_pick_by_length, ctx, 0.0);
+    bench_run("word_index_random_length", words, bench_random_length, ctx, 0.0);
+
+    normal_mode_init(&ctx->game);
+    if (ctx->game.hangman) {
+        bench_run("normal_mode_process_key", words, bench_normal_process_key, ctx, 0.0);
+        normal_mode_cleanup(&ctx->game);
+    }
+    hard_mode_init(&ctx->game);
+    if (ctx->game.hangman) {
+        bench_run("hard_mode_process_key", words, bench_hard_process_key, ctx, 0.0);
+        hard_mode_cleanup(&ctx->game);
+    }
+    versus_mode_init(&ctx->game);
+    if (ctx->game.versus_data) {
+        bench_run("versus_mode_process_key", words, bench_versus_process_key, ctx, 0.0);
+        versus_mode_cleanup(&ctx->game);
+    }
+    evil_mode_init(&ctx->game);
+    if (ctx->game.hangman) {
+        bench_run("evil_mode_process_key", words, bench_evil_process_key, ctx, 0.0);
+        evil_mode_cleanup(&ctx->game);
+    }
+    parallel_pool_destroy(ctx->game.workers);
+    ctx->game.workers = NULL;
+
+    ctx->hangman.dictionary = ctx->dictionary;
+    rules_normal_reset(&ctx->hangman, &ctx->env);
+    bench_run("rules_normal_guess", words, bench_rules_normal_guess, ctx, 0.0);
+    rules_normal_reset(&ctx->hangman, &ctx->env);
+    bench_run("rules_versus_update_displayed_word", words, bench_update_displayed_word, ctx, 0.0);
+    bench_patterns(ctx, words);
+
+    dictionary_cache_release(ctx->dictionary);
+    dictionary_cache_shutdown();
+    free(ctx);
+}
+
+// ---------------- benchmark-uri de randare ----------------
+
+typedef struct BenchRenderContext {
+    SDL_Renderer* renderer;
+    TTF_Font* font;
+} BenchRenderContext;
+
+// comenzile SDL sunt puse in coada; flush-ul la final face ca timpul sa includa si desenarea
+static void bench_render_flush(SDL_Renderer* renderer) {
+#if SDL_VERSION_ATLEAST(2, 0, 10)
+    SDL_RenderFlush(renderer);
+#endif
+}
+
+static void bench_render_text_atlas(void* data, long iterations) {
+    BenchRenderContext* ctx = (BenchRenderContext*)data;
+    SDL_Color white = {255, 255, 255, 255};
+    for (long i = 0; i < iterations; i++) {
+        render_text(ctx->renderer, ctx->font, "Wrong Guesses: 3/6", white, 20, 70);
+    }
+    bench_render_flush(ctx->renderer);
+}
+
+// caracterele din afara ASCII nu sunt in atlas: text rasterizat + textura noua la fiecare apel
+static void bench_render_text_uncached(void* data, long iterations) {
+    BenchRenderContext* ctx = (BenchRenderContext*)data;
+    SDL_Color white = {255, 255, 255, 255};
+    for (long i = 0; i < iterations; i++) {
+        render_text(ctx->renderer, ctx->font, "Cuv\xE2nt gre\xBAit", white, 20, 70);
+    }
+    bench_render_flush(ctx->renderer);
+}
+
+static void bench_render_hangman_image(void* data, long iterations) {
+    BenchRenderContext* ctx = (BenchRenderContext*)data;
+    SDL_SetRenderDrawColor(ctx->renderer, 255, 255, 255, 255);
+    for (long i = 0; i < iterations; i++) {
+        render_hangman_image(ctx->renderer, (int)(i % (MAX_WRONG_GUESSES + 1)), (i & 8) ? WIDTH / 2 : 0, 0, (i & 8) != 0);
+    }
+    bench_render_flush(ctx->renderer);
+}
+
+static bool bench_render(const char* font_path) {
+    SDL_setenv("SDL_VIDEODRIVER", "dummy", 0);
+    if (SDL_Init(SDL_INIT_VIDEO) < 0 || TTF_Init() < 0) {
+        fprintf(stderr, "ERROR: bench_render: SDL init failed: %s\n", SDL_GetError());
+        return false;
+    }
+    SDL_Window* window = SDL_CreateWindow("hangman_bench", 0, 0, WIDTH, HEIGHT, SDL_WINDOW_HIDDEN);
+    SDL_Renderer* renderer = window ? SDL_CreateRenderer(window, -1, 0) : NULL;
+    SDL_Surface* surface = NULL;
+    if (!renderer) {
+        // driverul dummy nu are mereu framebuffer: se deseneaza intr-o suprafata in memorie
+        surface = SDL_CreateRGBSurfaceWithFormat(0, WIDTH, HEIGHT, 32, SDL_PIXELFORMAT_RGBA32);
+        renderer = surface ? SDL_CreateSoftwareRenderer(surface) : NULL;
+    }
+    TTF_Font* font = TTF_OpenFont(font_path, FONT_SIZE);
+    if (!renderer || !font) {
+        fprintf(stderr, "ERROR: bench_render: No renderer or font (%s): %s\n", font_path, SDL_GetError());
+        if (font) TTF_CloseFont(font);
+        if (renderer) SDL_DestroyRenderer(renderer);
+        if (surface) SDL_FreeSurface(surface);
+        if (window) SDL_DestroyWindow(window);
+        return false;
+    }
+    SDL_RendererInfo info;
+    if (SDL_GetRendererInfo(renderer, &info) == 0) {
+        printf("# video driver %s, renderer %s\n", SDL_GetCurrentVideoDriver(), info.name);
+    }
+
+    BenchRenderContext ctx = {renderer, font};
+    bench_run("render_text (atlas)", 0, bench_render_text_atlas, &ctx, 0.0);
+    bench_run("render_text (uncached)", 0, bench_render_text_uncached, &ctx, 0.0);
+    bench_run("render_hangman_image", 0, bench_render_hangman_image, &ctx, 0.0);
+
+    text_atlas_cache_clear();
+    gallows_cache_clear();
+    TTF_CloseFont(font);
+    SDL_DestroyRenderer(renderer);
+    if (surface) SDL_FreeSurface(surface);
+    if (window) SDL_DestroyWindow(window);
+    return true;
+}
+
+// ---------------- main ----------------
+
+static int bench_parse_sizes(const char* text, int* sizes) {
+    int count = 0;
+    char* end = NULL;
+    while (*text && count < BENCH_MAX_SIZES) {
+        long value = strtol(text, &end, 10);
+        if (end == text || value <= 0 || value > 100000000L) {
+            return -1;
+        }
+        if (*end == 'k' || *end == 'K') { value *= 1000; end++; }
+        else if (*end == 'm' || *end == 'M') { value *= 1000000; end++; }
+        sizes[count++] = (int)value;
+        text = (*end == ',') ? end + 1 : end;
+        if (*end != ',' && *end != '\0') {
+            return -1;
+        }
+    }
+    return count;
+}
+
+int main(int argc, char** argv) {
+    int sizes[BENCH_MAX_SIZES] = {1000, 10000, 100000, 1000000};
+    int size_count = 4;
+    const char* font_path = BENCH_DEFAULT_FONT;
+    bool verbose = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--words") == 0 && i + 1 < argc) {
+            size_count = bench_parse_sizes(argv[++i], sizes);
+        } else if (strcmp(argv[i], "--min-time-ms") == 0 && i + 1 < argc) {
+            bench_min_time_s = atof(argv[++i]) / 1000.0;
+        } else if (strcmp(argv[i], "--font") == 0 && i + 1 < argc) {
+            font_path = argv[++i];
+        } else if (strcmp(argv[i], "--verbose") == 0) {
+            verbose = true;
+        } else {
+            size_count = -1;
+        }
+        if (size_count <= 0) {
+            fprintf(stderr, "usage: %s [--words 1k,100k,10M] [--min-time-ms 200] [--font file.ttf] [--verbose]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    // inainte de orice alocare facuta de SDL
+    SDL_GetMemoryFunctions(&sdl_malloc_original, &sdl_calloc_original, &sdl_realloc_original, &sdl_free_original);
+    SDL_SetMemoryFunctions(bench_sdl_malloc, bench_sdl_calloc, bench_sdl_realloc, bench_sdl_free);
+
+    // modurile de joc scriu mesaje DEBUG pe stderr; nu intra in timpi decat cu --verbose
+    if (!verbose && !freopen("/dev/null", "w", stderr)) {
+        return 1;
+    }
+
+    printf("%-44s %9s %12s %10s %14s %9s\n", "benchmark", "words", "ns/op", "allocs/op", "ops/s", "MB/s");
+    bool ok = bench_render(font_path);
+
+    // dictionarele sintetice se scriu ca words_en.txt/.bin intr-un director temporar
+    char scratch_dir[] = "/tmp/hangman_bench.XXXXXX";
+    if (!mkdtemp(scratch_dir) || chdir(scratch_dir) != 0) {
+        printf("ERROR: cannot create a scratch directory\n");
+        SDL_Quit();
+        return 1;
+    }
+    for (int i = 0; i < size_count; i++) {
+        bench_dictionary(sizes[i], verbose);
+    }
+    remove(dictionary_cache_filename(LANG_ENGLISH));
+    remove(dictionary_cache_binary_filename(LANG_ENGLISH));
+    if (chdir("/") == 0) {
+        rmdir(scratch_dir);
+    }
+
+    TTF_Quit();
+    SDL_Quit();
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,93 @@
+// dict_compile.c - compileaza words_*.txt intr-un dictionar binar (.bin) pe care jocul il mapeaza direct
+//
+//   dict_compile words_en.txt words_en.bin
+//   dict_compile --verify words_en.bin
+//
+// Build: gcc -O2 -I.. dict_compile.c ../dictionary.c ../word_index.c -o dict_compile
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "dictionary.h"
+
+static int verify(const char* filename) {
+    FILE* file = fopen(filename, "rb");
+    if (!file) {
+        fprintf(stderr, "ERROR: Cannot open %s\n", filename);
+        return 1;
+    }
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    unsigned char* data = (size > 0) ? (unsigned char*)malloc((size_t)size) : NULL;
+    if (!data || fread(data, 1, (size_t)size, file) != (size_t)size || (size_t)size < sizeof(DictionaryFileHeader)) {
+        fprintf(stderr, "ERROR: Cannot read %s\n", filename);
+        fclose(file);
+        free(data);
+        return 1;
+    }
+    fclose(file);
+
+    const DictionaryFileHeader* header = (const DictionaryFileHeader*)data;
+    uint32_t stored = header->checksum;
+    uint32_t checksum = dictionary_checksum(data + header->header_size, (size_t)size - header->header_size);
+    free(data);
+    if (checksum != stored) {
+        fprintf(stderr, "ERROR: %s: checksum mismatch (stored %08x, computed %08x)\n", filename, stored, checksum);
+        return 1;
+    }
+
+    // a doua verificare: chiar loader-ul jocului
+    Dictionary dict;
+    if (!dictionary_load_binary(&dict, filename)) {
+        return 1;
+    }
+    if (!dictionary_verify_tables(&dict)) {
+        fprintf(stderr, "ERROR: %s: word tables are inconsistent\n", filename);
+        dictionary_free(&dict);
+        return 1;
+    }
+    for (int i = 0; i < dict.word_count; i++) {
+        const char* word = dictionary_word(&dict, i);
+        if (strlen(word) != dict.lengths[i] || dictionary_letter_mask(word, dict.lengths[i]) != dict.letter_masks[i]) {
+            fprintf(stderr, "ERROR: %s: word %d is inconsistent\n", filename, i);
+            dictionary_free(&dict);
+            return 1;
+        }
+    }
+    if (dictionary_words_checksum(&dict) != dict.words_checksum) {
+        fprintf(stderr, "ERROR: %s: words checksum mismatch (stored %08x, computed %08x)\n", filename,
+                dict.words_checksum, dictionary_words_checksum(&dict));
+        dictionary_free(&dict);
+        return 1;
+    }
+    printf("%s: OK, %d words, version %d\n", filename, dict.word_count, DICTIONARY_FILE_VERSION);
+    dictionary_free(&dict);
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    if (argc == 3 && strcmp(argv[1], "--verify") == 0) {
+        return verify(argv[2]);
+    }
+    if (argc != 3) {
+        fprintf(stderr, "usage: %s words.txt words.bin\n       %s --verify words.bin\n", argv[0], argv[0]);
+        return 2;
+    }
+
+    Dictionary dict;
+    if (!dictionary_load_text(&dict, argv[1])) {
+        return 1;
+    }
+    bool ok = dictionary_write_binary(&dict, argv[2]);
+    if (ok) {
+        printf("%s -> %s: %d words\n", argv[1], argv[2], dict.word_count);
+        for (int i = 0; i < dict.index.available_count; i++) {
+            int len = dict.index.available_lengths[i];
+            printf("  length %2d: %d\n", len, word_index_count_of_length(&dict.index, len));
+        }
+    }
+    dictionary_free(&dict);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,286 @@
+// difficulty.c - calculeaza scorul de dificultate al fiecarui cuvant si il scrie langa dictionar (.scores)
+//
+//   hangman_difficulty [--strategy entropy|candidates|frequency|random] [--threads N] [words_en.txt ...]
+//
+// Fara fisiere: words_en.txt si words_ro.txt din directorul curent (sau .bin-urile lor, daca exista);
+// words_en.txt -> words_en.scores, pe care jocul il citeste la incarcarea dictionarului.
+// Dificultatea bruta a unui cuvant combina:
+//   - ratarile solver-ului pana la cuvantul complet (solver.c, implicit strategia F1 hint-ului),
+//   - raritatea literelor: media lui -log2(fractiunea cuvintelor care contin litera) peste literele distincte,
+//   - literele repetate: 1 - litere distincte / lungime (mai putine litere de nimerit, fiecare mai greu de gasit).
+// Scorul salvat e percentila dificultatii brute in tot dictionarul (0..255), deci nivelurile din
+// difficulty_index.h au cam acelasi numar de cuvinte. Cuvintele sunt impartite pe toate nucleele (parallel.c);
+// fiecare partida e reproductibila, asa ca fisierul nu depinde de numarul de fire.
+//
+// Build: cmake -S . -B build && cmake --build build --target hangman_difficulty
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+
+#include "dictionary.h"
+#include "pattern_index.h"
+#include "parallel.h"
+#include "solver.h"
+
+#define DIFFICULTY_GRAIN_WORDS 64
+#define DIFFICULTY_MISS_WEIGHT 1.0     // o ratare a solver-ului
+#define DIFFICULTY_RARITY_WEIGHT 0.75  // per bit de raritate medie a literelor
+#define DIFFICULTY_REPEAT_WEIGHT 2.0   // cuvant facut numai din repetitii (ex. "AAAA") = 2 ratari in plus
+#define DIFFICULTY_EXAMPLES 6
+
+typedef struct DifficultyJob {
+    const Dictionary* dictionary;
+    Solver* solvers;               // unul pe worker
+    HangmanGame* games;            // unul pe worker
+    long (*letter_counts)[ALPHABET_SIZE];   // pe worker, in prima trecere
+    double surprisal[ALPHABET_SIZE];        // -log2 din fractiunea cuvintelor care contin litera
+    uint8_t* misses;
+    float* raw;
+} DifficultyJob;
+
+static double difficulty_now_seconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+}
+
+static void difficulty_count_letters(void* context, int begin, int end, int worker) {
+    DifficultyJob* job = (DifficultyJob*)context;
+    long* counts = job->letter_counts[worker];
+    for (int i = begin; i < end; i++) {
+        uint32_t mask = job->dictionary->letter_masks[i];
+        while (mask) {
+            counts[__builtin_ctz(mask)]++;
+            mask &= mask - 1;
+        }
+    }
+}
+
+static void difficulty_score_words(void* context, int begin, int end, int worker) {
+    DifficultyJob* job = (DifficultyJob*)context;
+    const Dictionary* dictionary = job->dictionary;
+    Solver* solver = &job->solvers[worker];
+    HangmanGame* hangman = &job->games[worker];
+    for (int i = begin; i < end; i++) {
+        // seed-ul tine de cuvant, nu de fir (ca in tools/solve.c)
+        SolverResult result = solver_play_word(solver, hangman, dictionary_word(dictionary, i), (uint32_t)i * 2654435761u + 1u, NULL);
+        job->misses[i] = (uint8_t)(result.misses_to_solve > 255 ? 255 : result.misses_to_solve);
+
+        uint32_t mask = dictionary->letter_masks[i];
+        int distinct = __builtin_popcount(mask);
+        double rarity = 0.0;
+        for (uint32_t m = mask; m; m &= m - 1) {
+            rarity += job->surprisal[__builtin_ctz(m)];
+        }
+        rarity = distinct > 0 ? rarity / distinct : 0.0;
+        double repeats = dictionary->lengths[i] > 0 ? 1.0 - (double)distinct / dictionary->lengths[i] : 0.0;
+        job->raw[i] = (float)(DIFFICULTY_MISS_WEIGHT * result.misses_to_solve + DIFFICULTY_RARITY_WEIGHT * rarity +
+                              DIFFICULTY_REPEAT_WEIGHT * repeats);
+    }
+}
+
+static const float* difficulty_sort_raw; // pentru qsort (ruleaza pe un singur fir)
+
+static int difficulty_compare_raw(const void* a, const void* b) {
+    int i = *(const int*)a;
+    int j = *(const int*)b;
+    if (difficulty_sort_raw[i] != difficulty_sort_raw[j]) {
+        return difficulty_sort_raw[i] < difficulty_sort_raw[j] ? -1 : 1;
+    }
+    return i - j;
+}
+
+// percentila dificultatii brute; cuvintele cu aceeasi valoare primesc acelasi scor
+static bool difficulty_rank(const DifficultyJob* job, int n, unsigned char* scores) {
+    int* order = (int*)malloc((size_t)n * sizeof(int));
+    if (!order) {
+        return false;
+    }
+    for (int i = 0; i < n; i++) {
+        order[i] = i;
+    }
+    difficulty_sort_raw = job->raw;
+    qsort(order, (size_t)n, sizeof(int), difficulty_compare_raw);
+    int run_start = 0;
+    for (int r = 0; r < n; r++) {
+        if (job->raw[order[r]] != job->raw[order[run_start]]) {
+            run_start = r;
+        }
+        scores[order[r]] = (unsigned char)((int64_t)run_start * 256 / n);
+    }
+    free(order);
+    return true;
+}
+
+static void difficulty_report(const Dictionary* dictionary, const DifficultyJob* job, const unsigned char* scores) {
+    long words[DIFFICULTY_LEVELS] = {0};
+    long letters[DIFFICULTY_LEVELS] = {0};
+    long misses[DIFFICULTY_LEVELS] = {0};
+    int examples[DIFFICULTY_LEVELS][DIFFICULTY_EXAMPLES];
+    for (int i = 0; i < dictionary->word_count; i++) {
+        int level = difficulty_level_of_score(scores[i]);
+        if (words[level] < DIFFICULTY_EXAMPLES) {
+            examples[level][words[level]] = i;
+        }
+        words[level]++;
+        letters[level] += dictionary->lengths[i];
+        misses[level] += job->misses[i];
+    }
+    printf("  level    words  avg length  avg misses  examples\n");
+    for (int level = 0; level < DIFFICULTY_LEVELS; level++) {
+        if (words[level] == 0) {
+            printf("  %5d %8d\n", level + 1, 0);
+            continue;
+        }
+        printf("  %5d %8ld %11.2f %11.2f  ", level + 1, words[level], (double)letters[level] / words[level],
+               (double)misses[level] / words[level]);
+        for (int e = 0; e < words[level] && e < DIFFICULTY_EXAMPLES; e++) {
+            printf("%s%s", e ? ", " : "", dictionary_word(dictionary, examples[level][e]));
+        }
+        printf("\n");
+    }
+}
+
+static int difficulty_dictionary(const char* filename, const SolverStrategy* strategy, ParallelPool* pool) {
+    Dictionary dictionary;
+    size_t length = strlen(filename);
+    bool loaded = false;
+    if (length > 4 && strcmp(filename + length - 4, ".txt") == 0) {
+        // ca jocul: .bin-ul de langa .txt daca e valid, altfel textul
+        char binary[4096];
+        snprintf(binary, sizeof(binary), "%.*s.bin", (int)(length - 4), filename);
+        loaded = dictionary_load(&dictionary, binary, filename);
+    } else {
+        loaded = dictionary_load_binary(&dictionary, filename);
+    }
+    if (!loaded || dictionary.word_count == 0) {
+        fprintf(stderr, "ERROR: Cannot load %s\n", filename);
+        if (loaded) {
+            dictionary_free(&dictionary);
+        }
+        return 1;
+    }
+    char output[4096];
+    const char* dot = strrchr(filename, '.');
+    int stem = (dot && strchr(dot, '/') == NULL) ? (int)(dot - filename) : (int)length;
+    snprintf(output, sizeof(output), "%.*s.scores", stem, filename);
+
+    PatternIndex patterns;
+    pattern_index_init(&patterns, &dictionary);
+    solver_prepare_patterns(&patterns);
+
+    int workers = parallel_pool_size(pool);
+    int n = dictionary.word_count;
+    DifficultyJob job;
+    memset(&job, 0, sizeof(job));
+    job.dictionary = &dictionary;
+    job.solvers = (Solver*)calloc((size_t)workers, sizeof(Solver));
+    job.games = (HangmanGame*)calloc((size_t)workers, sizeof(HangmanGame));
+    job.letter_counts = (long (*)[ALPHABET_SIZE])calloc((size_t)workers, sizeof(long[ALPHABET_SIZE]));
+    job.misses = (uint8_t*)malloc((size_t)n);
+    job.raw = (float*)malloc((size_t)n * sizeof(float));
+    unsigned char* scores = (unsigned char*)malloc((size_t)n);
+    int status = 0;
+    if (!job.solvers || !job.games || !job.letter_counts || !job.misses || !job.raw || !scores) {
+        fprintf(stderr, "ERROR: Out of memory for %d words\n", n);
+        status = 1;
+    }
+
+    if (status == 0) {
+        printf("%s: %d words, strategy %s, %d threads\n", filename, n, strategy->name, workers);
+        double start = difficulty_now_seconds();
+        parallel_for(pool, n, DIFFICULTY_GRAIN_WORDS * 16, difficulty_count_letters, &job);
+        for (int letter = 0; letter < ALPHABET_SIZE; letter++) {
+            long count = 0;
+            for (int w = 0; w < workers; w++) {
+                count += job.letter_counts[w][letter];
+            }
+            // o litera care nu apare in niciun cuvant nu intra oricum in vreo masca
+            job.surprisal[letter] = count > 0 ? -log2((double)count / n) : 0.0;
+        }
+        for (int w = 0; w < workers; w++) {
+            solver_init(&job.solvers[w], strategy, &patterns);
+            job.games[w].dictionary = &dictionary;
+        }
+        parallel_for(pool, n, DIFFICULTY_GRAIN_WORDS, difficulty_score_words, &job);
+        for (int w = 0; w < workers; w++) {
+            solver_free(&job.solvers[w]);
+        }
+        if (!difficulty_rank(&job, n, scores)) {
+            fprintf(stderr, "ERROR: Out of memory for %d words\n", n);
+            status = 1;
+        }
+        double seconds = difficulty_now_seconds() - start;
+        if (status == 0) {
+            difficulty_report(&dictionary, &job, scores);
+            if (dictionary_write_difficulty(&dictionary, scores, output)) {
+                printf("  wrote %s in %.2f s (%.0f words/s)\n", output, seconds, n / (seconds > 0 ? seconds : 1e-9));
+            } else {
+                fprintf(stderr, "ERROR: Cannot write %s\n", output);
+                status = 1;
+            }
+        }
+    }
+
+    free(scores);
+    free(job.solvers);
+    free(job.games);
+    free(job.letter_counts);
+    free(job.misses);
+    free(job.raw);
+    pattern_index_free(&patterns);
+    dictionary_free(&dictionary);
+    return status;
+}
+
+static void difficulty_usage(const char* program) {
+    fprintf(stderr, "usage: %s [--strategy NAME] [--threads N] [words.txt|words.bin ...]\n", program);
+    fprintf(stderr, "strategies:\n");
+    for (int i = 0; i < solver_strategy_count; i++) {
+        fprintf(stderr, "  %-11s %s\n", solver_strategies[i].name, solver_strategies[i].description);
+    }
+}
+
+int main(int argc, char** argv) {
+    const SolverStrategy* strategy = solver_strategy_find("entropy");
+    int threads = 0;
+    const char* files[64];
+    int file_count = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--strategy") == 0 && i + 1 < argc) {
+            strategy = solver_strategy_find(argv[++i]);
+            if (strategy == NULL) {
+                fprintf(stderr, "ERROR: Unknown strategy %s\n", argv[i]);
+                difficulty_usage(argv[0]);
+                return 2;
+            }
+        } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threads = atoi(argv[++i]);
+        } else if (argv[i][0] == '-' || file_count == (int)(sizeof(files) / sizeof(files[0]))) {
+            difficulty_usage(argv[0]);
+            return 2;
+        } else {
+            files[file_count++] = argv[i];
+        }
+    }
+    if (file_count == 0) {
+        files[file_count++] = "words_en.txt";
+        files[file_count++] = "words_ro.txt";
+    }
+
+    ParallelPool* pool = parallel_pool_create(threads);
+    if (pool == NULL) {
+        return 1;
+    }
+    int status = 0;
+    for (int i = 0; i < file_count; i++) {
+        status |= difficulty_dictionary(files[i], strategy, pool);
+    }
+    parallel_pool_destroy(pool);
+    return status;
+}
@@ -0,0 +1,437 @@
+// opening_book.c - precalculeaza primele litere recomandate pe fiecare lungime (cartea de deschideri, .book)
+//
+//   hangman_book [--depth N] [--min-candidates K] [--threads N] [words_en.txt ...]
+//
+// Fara fisiere: words_en.txt si words_ro.txt din directorul curent (sau .bin-urile lor, daca exista);
+// words_en.txt -> words_en.book, pe care jocul il citeste la primul mod cu hint-uri sau bot.
+// La inceputul rundei candidatii sunt toti cuvintele lungimii, exact cand hint-ul live e cel mai scump
+// (si cand, peste HINT_EXACT_BUDGET, se multumeste cu lovit/ratat). Aici fiecare nod alege litera cu
+// castigul de informatie exact, pe toate rezultatele posibile, apoi coboara in fiecare rezultat cu cel
+// putin K candidati, pana la N litere (implicit 3). Lungimile sunt impartite pe nuclee (parallel.c).
+//
+// Build: cmake -S . -B build && cmake --build build --target hangman_book
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+
+#include "dictionary.h"
+#include "pattern_index.h"
+#include "parallel.h"
+#include "opening_book.h"
+
+#define BOOK_DEFAULT_DEPTH 3
+#define BOOK_DEFAULT_MIN_CANDIDATES 50
+#define BOOK_MAX_CHILDREN 255   // OpeningBookNode.child_count
+
+// nodurile unei lungimi, cu first_child relativ la inceputul listei; concatenate la final
+typedef struct BookTree {
+    OpeningBookNode* nodes;
+    int count;
+    int capacity;
+    bool failed;
+} BookTree;
+
+// starea unui fir: cheile (litera, pozitii) ale candidatilor, refolosite de la un nod la altul
+typedef struct BookScratch {
+    uint64_t* keys;
+    size_t capacity;
+} BookScratch;
+
+typedef struct BookJob {
+    PatternIndex* patterns;
+    const int* lengths;         // lungimile de calculat, una pe element de parallel_for
+    BookTree* trees;            // una pe lungime
+    BookScratch* scratch;       // una pe worker
+    int depth;
+    int min_candidates;
+} BookJob;
+
+typedef struct BookOutcome {
+    uint32_t positions;
+    int count;
+} BookOutcome;
+
+static double book_now_seconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+}
+
+static int book_add_nodes(BookTree* tree, int count) {
+    if (tree->count + count > tree->capacity) {
+        int capacity = tree->capacity ? tree->capacity * 2 : 64;
+        while (capacity < tree->count + count) {
+            capacity *= 2;
+        }
+        OpeningBookNode* nodes = (OpeningBookNode*)realloc(tree->nodes, (size_t)capacity * sizeof(OpeningBookNode));
+        if (!nodes) {
+            tree->failed = true;
+            return -1;
+        }
+        tree->nodes = nodes;
+        tree->capacity = capacity;
+    }
+    int first = tree->count;
+    memset(tree->nodes + first, 0, (size_t)count * sizeof(OpeningBookNode));
+    tree->count += count;
+    return first;
+}
+
+static int book_compare_keys(const void* a, const void* b) {
+    uint64_t x = *(const uint64_t*)a;
+    uint64_t y = *(const uint64_t*)b;
+    return x < y ? -1 : x > y;
+}
+
+static int book_compare_outcomes_by_count(const void* a, const void* b) {
+    const BookOutcome* x = (const BookOutcome*)a;
+    const BookOutcome* y = (const BookOutcome*)b;
+    if (x->count != y->count) {
+        return y->count - x->count;
+    }
+    return x->positions < y->positions ? -1 : x->positions > y->positions;
+}
+
+static int book_compare_outcomes_by_positions(const void* a, const void* b) {
+    const BookOutcome* x = (const BookOutcome*)a;
+    const BookOutcome* y = (const BookOutcome*)b;
+    return x->positions < y->positions ? -1 : x->positions > y->positions;
+}
+
+static double book_k_log_k(long k) {
+    return k > 1 ? (double)k * log2((double)k) : 0.0;
+}
+
+// Litera cu castigul de informatie exact cel mai mare (ca hint_best_letter, la egalitate mai multe lovituri,
+// apoi litera mai mica) si rezultatele ei; -1 daca nicio litera neincercata nu mai desparte nimic.
+static int book_best_letter(const PatternBucket* bucket, const uint64_t* candidates, int n, uint32_t guessed_mask,
+                            uint32_t unknown_positions, BookScratch* scratch, BookOutcome* outcomes, int* outcome_count) {
+    size_t needed = (size_t)n * (size_t)__builtin_popcount(unknown_positions);
+    if (needed > scratch->capacity) {
+        uint64_t* keys = (uint64_t*)realloc(scratch->keys, needed * sizeof(uint64_t));
+        if (!keys) {
+            return -1;
+        }
+        scratch->keys = keys;
+        scratch->capacity = needed;
+    }
+    size_t key_count = 0;
+    for (int j = pattern_bucket_next(bucket, candidates, 0); j >= 0; j = pattern_bucket_next(bucket, candidates, j + 1)) {
+        const char* word = pattern_bucket_word(bucket, j);
+        uint32_t positions[ALPHABET_SIZE];
+        uint32_t present = 0;
+        for (uint32_t unknown = unknown_positions; unknown; unknown &= unknown - 1) {
+            int p = __builtin_ctz(unknown);
+            int letter = word[p] - 'A';
+            if (guessed_mask & (1u << letter)) {
+                continue;
+            }
+            if (!(present & (1u << letter))) {
+                present |= 1u << letter;
+                positions[letter] = 0;
+            }
+            positions[letter] |= 1u << p;
+        }
+        for (; present; present &= present - 1) {
+            int letter = __builtin_ctz(present);
+            scratch->keys[key_count++] = ((uint64_t)letter << 32) | positions[letter];
+        }
+    }
+    qsort(scratch->keys, key_count, sizeof(uint64_t), book_compare_keys);
+
+    double sum_k_log_k[ALPHABET_SIZE] = {0};
+    int hits[ALPHABET_SIZE] = {0};
+    for (size_t start = 0; start < key_count;) {
+        size_t end = start + 1;
+        while (end < key_count && scratch->keys[end] == scratch->keys[start]) {
+            end++;
+        }
+        int letter = (int)(scratch->keys[start] >> 32);
+        hits[letter] += (int)(end - start);
+        sum_k_log_k[letter] += book_k_log_k((long)(end - start));
+        start = end;
+    }
+
+    int best = -1;
+    double best_entropy = -1.0;
+    for (int letter = 0; letter < ALPHABET_SIZE; letter++) {
+        if ((guessed_mask & (1u << letter)) || hits[letter] == 0) {
+            continue;
+        }
+        double entropy = log2((double)n) - (sum_k_log_k[letter] + book_k_log_k(n - hits[letter])) / n;
+        if (entropy > best_entropy + 1e-9 || (entropy > best_entropy - 1e-9 && hits[letter] > hits[best])) {
+            best = letter;
+            best_entropy = entropy;
+        }
+    }
+    if (best < 0) {
+        return -1;
+    }
+
+    // rezultatele literei alese: grupurile cheilor ei, plus ratarea
+    *outcome_count = 0;
+    if (n - hits[best] > 0) {
+        outcomes[(*outcome_count)++] = (BookOutcome){0, n - hits[best]};
+    }
+    for (size_t start = 0; start < key_count;) {
+        size_t end = start + 1;
+        while (end < key_count && scratch->keys[end] == scratch->keys[start]) {
+            end++;
+        }
+        if ((int)(scratch->keys[start] >> 32) == best) {
+            outcomes[(*outcome_count)++] = (BookOutcome){(uint32_t)scratch->keys[start], (int)(end - start)};
+        }
+        start = end;
+    }
+    return best;
+}
+
+static void book_expand(BookJob* job, const PatternBucket* bucket, BookTree* tree, int node, const uint64_t* candidates,
+                        int n, uint32_t guessed_mask, uint32_t unknown_positions, int depth, BookScratch* scratch) {
+    // cel mult n + 1 rezultate (ratarea si cate un set de pozitii pe candidat)
+    BookOutcome* outcomes = (BookOutcome*)malloc(((size_t)n + 1) * sizeof(BookOutcome));
+    int outcome_count = 0;
+    int letter = outcomes ? book_best_letter(bucket, candidates, n, guessed_mask, unknown_positions, scratch,
+                                             outcomes, &outcome_count) : -1;
+    if (letter < 0) {
+        tree->failed = tree->failed || outcomes == NULL;
+        free(outcomes);
+        return;
+    }
+    tree->nodes[node].letter = (uint8_t)letter;
+    tree->nodes[node].candidates = (uint32_t)n;
+    if (depth + 1 >= job->depth) {
+        free(outcomes);
+        return;
+    }
+
+    // doar rezultatele unde calculul live ar costa; cele mai mari daca sunt prea multe
+    qsort(outcomes, (size_t)outcome_count, sizeof(BookOutcome), book_compare_outcomes_by_count);
+    int kept = 0;
+    while (kept < outcome_count && kept < BOOK_MAX_CHILDREN && outcomes[kept].count >= job->min_candidates) {
+        kept++;
+    }
+    if (kept == 0) {
+        free(outcomes);
+        return;
+    }
+    qsort(outcomes, (size_t)kept, sizeof(BookOutcome), book_compare_outcomes_by_positions);
+    int first = book_add_nodes(tree, kept);
+    uint64_t* child_candidates = first >= 0 ? (uint64_t*)malloc((size_t)bucket->block_count * sizeof(uint64_t)) : NULL;
+    if (!child_candidates) {
+        tree->failed = true;
+        free(outcomes);
+        return;
+    }
+    tree->nodes[node].first_child = (uint32_t)first;
+    tree->nodes[node].child_count = (uint8_t)kept;
+    for (int c = 0; c < kept; c++) {
+        tree->nodes[first + c].positions = outcomes[c].positions;
+        memcpy(child_candidates, candidates, (size_t)bucket->block_count * sizeof(uint64_t));
+        int count = pattern_bucket_apply_guess(bucket, child_candidates, letter, outcomes[c].positions, unknown_positions);
+        book_expand(job, bucket, tree, first + c, child_candidates, count, guessed_mask | (1u << letter),
+                    unknown_positions & ~outcomes[c].positions, depth + 1, scratch);
+    }
+    free(child_candidates);
+    free(outcomes);
+}
+
+static void book_build_lengths(void* context, int begin, int end, int worker) {
+    BookJob* job = (BookJob*)context;
+    for (int i = begin; i < end; i++) {
+        int length = job->lengths[i];
+        BookTree* tree = &job->trees[i];
+        const PatternBucket* bucket = pattern_index_bucket(job->patterns, length); // deja construit
+        uint64_t* candidates = bucket ? (uint64_t*)malloc((size_t)bucket->block_count * sizeof(uint64_t)) : NULL;
+        if (!candidates) {
+            tree->failed = true;
+            continue;
+        }
+        char pattern[MAX_WORD_LENGTH + 1];
+        memset(pattern, '_', (size_t)length);
+        pattern[length] = '\0';
+        int n = pattern_bucket_query(bucket, pattern, 0, candidates);
+        if (book_add_nodes(tree, 1) == 0) {
+            book_expand(job, bucket, tree, 0, candidates, n, 0, (uint32_t)((1ull << length) - 1), 0, &job->scratch[worker]);
+        }
+        free(candidates);
+    }
+}
+
+static int book_dictionary(const char* filename, ParallelPool* pool, int depth, int min_candidates) {
+    Dictionary dictionary;
+    size_t length = strlen(filename);
+    bool loaded = false;
+    if (length > 4 && strcmp(filename + length - 4, ".txt") == 0) {
+        // ca jocul: .bin-ul de langa .txt daca e valid, altfel textul
+        char binary[4096];
+        snprintf(binary, sizeof(binary), "%.*s.bin", (int)(length - 4), filename);
+        loaded = dictionary_load(&dictionary, binary, filename);
+    } else {
+        loaded = dictionary_load_binary(&dictionary, filename);
+    }
+    if (!loaded || dictionary.word_count == 0) {
+        fprintf(stderr, "ERROR: Cannot load %s\n", filename);
+        if (loaded) {
+            dictionary_free(&dictionary);
+        }
+        return 1;
+    }
+    char output[4096];
+    const char* dot = strrchr(filename, '.');
+    int stem = (dot && strchr(dot, '/') == NULL) ? (int)(dot - filename) : (int)length;
+    snprintf(output, sizeof(output), "%.*s.book", stem, filename);
+
+    PatternIndex patterns;
+    pattern_index_init(&patterns, &dictionary);
+    const WordIndex* index = &dictionary.index;
+    for (int i = 0; i < index->available_count; i++) {
+        pattern_index_bucket(&patterns, index->available_lengths[i]);  // pe firul asta, inainte de paralel
+    }
+
+    int workers = parallel_pool_size(pool);
+    BookJob job;
+    memset(&job, 0, sizeof(job));
+    job.patterns = &patterns;
+    job.lengths = index->available_lengths;
+    job.trees = (BookTree*)calloc((size_t)index->available_count, sizeof(BookTree));
+    job.scratch = (BookScratch*)calloc((size_t)workers, sizeof(BookScratch));
+    job.depth = depth;
+    job.min_candidates = min_candidates;
+    int status = 0;
+    if (!job.trees || !job.scratch) {
+        fprintf(stderr, "ERROR: Out of memory\n");
+        status = 1;
+    }
+
+    OpeningBookNode* nodes = NULL;
+    if (status == 0) {
+        printf("%s: %d words, %d lengths, depth %d, nodes for >= %d candidates, %d threads\n", filename,
+               dictionary.word_count, index->available_count, depth, min_candidates, workers);
+        double start = book_now_seconds();
+        // lungimile mari (si cele cu multe cuvinte) dureaza diferit; work stealing le echilibreaza
+        parallel_for(pool, index->available_count, 1, book_build_lengths, &job);
+        double seconds = book_now_seconds() - start;
+
+        // concatenare: nodul 0 e rezervat, fiecare arbore e mutat dupa cei dinainte
+        uint32_t roots[WORD_INDEX_MAX_LENGTH + 1] = {0};
+        int total = 1;
+        for (int i = 0; i < index->available_count; i++) {
+            if (job.trees[i].failed) {
+                fprintf(stderr, "ERROR: Out of memory for length %d\n", index->available_lengths[i]);
+                status = 1;
+            }
+            total += job.trees[i].count;
+        }
+        nodes = status == 0 ? (OpeningBookNode*)calloc((size_t)total, sizeof(OpeningBookNode)) : NULL;
+        if (status == 0 && nodes == NULL) {
+            fprintf(stderr, "ERROR: Out of memory for %d nodes\n", total);
+            status = 1;
+        }
+        int base = 1;
+        for (int i = 0; i < index->available_count && status == 0; i++) {
+            const BookTree* tree = &job.trees[i];
+            if (tree->count == 0) {
+                continue;
+            }
+            for (int k = 0; k < tree->count; k++) {
+                nodes[base + k] = tree->nodes[k];
+                if (nodes[base + k].child_count > 0) {
+                    nodes[base + k].first_child += (uint32_t)base;
+                }
+            }
+            int len = index->available_lengths[i];
+            roots[len] = (uint32_t)base;
+            const OpeningBookNode* root = &nodes[base];
+            printf("  length %2d: %7d words, first %c, %4d nodes", len, word_index_count_of_length(index, len),
+                   'A' + root->letter, tree->count);
+            // a doua litera pe cel mai frecvent rezultat al primei
+            int widest = -1;
+            for (int c = 0; c < root->child_count; c++) {
+                const OpeningBookNode* child = &nodes[root->first_child + c];
+                if (widest < 0 || child->candidates > nodes[root->first_child + widest].candidates) {
+                    widest = c;
+                }
+            }
+            if (widest >= 0) {
+                const OpeningBookNode* child = &nodes[root->first_child + widest];
+                printf(", then %c on %s (%u words)", 'A' + child->letter, child->positions ? "a hit" : "a miss", child->candidates);
+            }
+            printf("\n");
+            base += tree->count;
+        }
+        if (status == 0) {
+            if (opening_book_write(&dictionary, nodes, total, roots, depth, output)) {
+                printf("  wrote %s: %d nodes, %zu bytes, in %.2f s\n", output, total,
+                       sizeof(OpeningBookFileHeader) + (size_t)total * sizeof(OpeningBookNode), seconds);
+            } else {
+                fprintf(stderr, "ERROR: Cannot write %s\n", output);
+                status = 1;
+            }
+        }
+    }
+
+    free(nodes);
+    for (int i = 0; job.trees && i < index->available_count; i++) {
+        free(job.trees[i].nodes);
+    }
+    for (int w = 0; job.scratch && w < workers; w++) {
+        free(job.scratch[w].keys);
+    }
+    free(job.trees);
+    free(job.scratch);
+    pattern_index_free(&patterns);
+    dictionary_free(&dictionary);
+    return status;
+}
+
+static void book_usage(const char* program) {
+    fprintf(stderr, "usage: %s [--depth 1-%d] [--min-candidates K] [--threads N] [words.txt|words.bin ...]\n",
+            program, OPENING_BOOK_MAX_DEPTH);
+}
+
+int main(int argc, char** argv) {
+    int depth = BOOK_DEFAULT_DEPTH;
+    int min_candidates = BOOK_DEFAULT_MIN_CANDIDATES;
+    int threads = 0;
+    const char* files[64];
+    int file_count = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--depth") == 0 && i + 1 < argc) {
+            depth = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--min-candidates") == 0 && i + 1 < argc) {
+            min_candidates = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threads = atoi(argv[++i]);
+        } else if (argv[i][0] == '-' || file_count == (int)(sizeof(files) / sizeof(files[0]))) {
+            book_usage(argv[0]);
+            return 2;
+        } else {
+            files[file_count++] = argv[i];
+        }
+    }
+    if (depth < 1 || depth > OPENING_BOOK_MAX_DEPTH || min_candidates < 1) {
+        book_usage(argv[0]);
+        return 2;
+    }
+    if (file_count == 0) {
+        files[file_count++] = "words_en.txt";
+        files[file_count++] = "words_ro.txt";
+    }
+
+    ParallelPool* pool = parallel_pool_create(threads);
+    if (pool == NULL) {
+        return 1;
+    }
+    int status = 0;
+    for (int i = 0; i < file_count; i++) {
+        status |= book_dictionary(files[i], pool, depth, min_candidates);
+    }
+    parallel_pool_destroy(pool);
+    return status;
+}
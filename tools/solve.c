@@ -0,0 +1,228 @@
+// solve.c - joaca fiecare cuvant din dictionar cu o strategie automata si raporteaza cat de greu e dictionarul
+//
+//   hangman_solve [--strategy entropy|candidates|frequency|random|all] [--threads N] [--hardest K] [words_en.txt ...]
+//
+// Fara fisiere: words_en.txt si words_ro.txt din directorul curent (sau .bin-urile lor, daca exista).
+// Cuvintele sunt impartite pe toate nucleele (parallel.c, work stealing); fiecare partida e independenta
+// si reproductibila, deci rezultatele nu depind de numarul de fire. Se raporteaza rata de castig la
+// MAX_WRONG_GUESSES greseli, media greselilor pe lungime, cele mai grele cuvinte si partide/s.
+//
+// Build: cmake -S . -B build && cmake --build build --target hangman_solve
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#include "dictionary.h"
+#include "pattern_index.h"
+#include "parallel.h"
+#include "solver.h"
+
+#define SOLVE_GRAIN_WORDS 64
+#define SOLVE_DEFAULT_HARDEST 10
+
+typedef struct SolveJob {
+    const Dictionary* dictionary;
+    Solver* solvers;               // unul pe worker
+    HangmanGame* games;            // unul pe worker
+    uint8_t* misses;               // misses_to_solve pentru fiecare cuvant din dictionar
+    uint8_t* guesses;
+} SolveJob;
+
+static double solve_now_seconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+}
+
+static void solve_words(void* context, int begin, int end, int worker) {
+    SolveJob* job = (SolveJob*)context;
+    Solver* solver = &job->solvers[worker];
+    HangmanGame* hangman = &job->games[worker];
+    for (int i = begin; i < end; i++) {
+        // seed-ul tine de cuvant, nu de fir
+        SolverResult result = solver_play_word(solver, hangman, dictionary_word(job->dictionary, i), (uint32_t)i * 2654435761u + 1u, NULL);
+        job->misses[i] = (uint8_t)(result.misses_to_solve > 255 ? 255 : result.misses_to_solve);
+        job->guesses[i] = (uint8_t)(result.guesses > 255 ? 255 : result.guesses);
+    }
+}
+
+static const uint8_t* solve_sort_misses; // pentru qsort (ruleaza pe un singur fir)
+
+static int solve_compare_hardest(const void* a, const void* b) {
+    int i = *(const int*)a;
+    int j = *(const int*)b;
+    if (solve_sort_misses[i] != solve_sort_misses[j]) {
+        return solve_sort_misses[j] - solve_sort_misses[i];
+    }
+    return i - j;
+}
+
+static void solve_report(const Dictionary* dictionary, const SolveJob* job, int hardest, double seconds) {
+    long wins = 0;
+    long wrong_by_length[WORD_INDEX_MAX_LENGTH + 1] = {0};
+    long wins_by_length[WORD_INDEX_MAX_LENGTH + 1] = {0};
+    long wrong_total = 0;
+    long guesses_total = 0;
+    for (int i = 0; i < dictionary->word_count; i++) {
+        int length = dictionary->lengths[i];
+        bool win = job->misses[i] < MAX_WRONG_GUESSES;
+        int wrong = win ? job->misses[i] : MAX_WRONG_GUESSES;
+        wins += win;
+        wins_by_length[length] += win;
+        wrong_by_length[length] += wrong;
+        wrong_total += wrong;
+        guesses_total += job->guesses[i];
+    }
+    int n = dictionary->word_count;
+    printf("  win rate %.2f%% (%ld/%d), %.2f wrong guesses and %.2f letters per word, %.0f games/s\n",
+           100.0 * wins / n, wins, n, (double)wrong_total / n, (double)guesses_total / n, n / seconds);
+    printf("  length    words    win%%  avg wrong\n");
+    const WordIndex* index = &dictionary->index;
+    for (int i = 0; i < index->available_count; i++) {
+        int length = index->available_lengths[i];
+        int count = word_index_count_of_length(index, length);
+        printf("  %6d %8d %7.2f %10.2f\n", length, count, 100.0 * wins_by_length[length] / count,
+               (double)wrong_by_length[length] / count);
+    }
+
+    // cele mai grele: cele mai multe ratari pana la cuvantul complet (si dupa pierdere)
+    if (hardest > n) {
+        hardest = n;
+    }
+    int* order = (int*)malloc((size_t)n * sizeof(int));
+    if (!order || hardest <= 0) {
+        free(order);
+        return;
+    }
+    for (int i = 0; i < n; i++) {
+        order[i] = i;
+    }
+    solve_sort_misses = job->misses;
+    qsort(order, (size_t)n, sizeof(int), solve_compare_hardest);
+    printf("  hardest:");
+    for (int i = 0; i < hardest; i++) {
+        printf("%s %s (%d)", i ? "," : "", dictionary_word(dictionary, order[i]), job->misses[order[i]]);
+    }
+    printf("\n");
+    free(order);
+}
+
+static int solve_dictionary(const char* filename, const SolverStrategy* only, ParallelPool* pool, int hardest) {
+    Dictionary dictionary;
+    size_t length = strlen(filename);
+    bool loaded = false;
+    if (length > 4 && strcmp(filename + length - 4, ".txt") == 0) {
+        // ca jocul: .bin-ul de langa .txt daca e valid, altfel textul
+        char binary[4096];
+        snprintf(binary, sizeof(binary), "%.*s.bin", (int)(length - 4), filename);
+        loaded = dictionary_load(&dictionary, binary, filename);
+    } else {
+        loaded = dictionary_load_binary(&dictionary, filename);
+    }
+    if (!loaded || dictionary.word_count == 0) {
+        fprintf(stderr, "ERROR: Cannot load %s\n", filename);
+        if (loaded) {
+            dictionary_free(&dictionary);
+        }
+        return 1;
+    }
+
+    PatternIndex patterns;
+    pattern_index_init(&patterns, &dictionary);
+    solver_prepare_patterns(&patterns);
+
+    int workers = parallel_pool_size(pool);
+    SolveJob job = {&dictionary, NULL, NULL, NULL, NULL};
+    job.solvers = (Solver*)calloc((size_t)workers, sizeof(Solver));
+    job.games = (HangmanGame*)calloc((size_t)workers, sizeof(HangmanGame));
+    job.misses = (uint8_t*)malloc((size_t)dictionary.word_count);
+    job.guesses = (uint8_t*)malloc((size_t)dictionary.word_count);
+    int status = 0;
+    if (!job.solvers || !job.games || !job.misses || !job.guesses) {
+        fprintf(stderr, "ERROR: Out of memory for %d words\n", dictionary.word_count);
+        status = 1;
+    }
+
+    for (int s = 0; s < solver_strategy_count && status == 0; s++) {
+        const SolverStrategy* strategy = &solver_strategies[s];
+        if (only != NULL && only != strategy) {
+            continue;
+        }
+        for (int w = 0; w < workers; w++) {
+            solver_init(&job.solvers[w], strategy, &patterns);
+            job.games[w].dictionary = &dictionary;
+        }
+        printf("%s: %d words, strategy %s (%s), %d threads\n", filename, dictionary.word_count,
+               strategy->name, strategy->description, workers);
+        double start = solve_now_seconds();
+        parallel_for(pool, dictionary.word_count, SOLVE_GRAIN_WORDS, solve_words, &job);
+        double seconds = solve_now_seconds() - start;
+        solve_report(&dictionary, &job, hardest, seconds > 0 ? seconds : 1e-9);
+        for (int w = 0; w < workers; w++) {
+            solver_free(&job.solvers[w]);
+        }
+    }
+
+    free(job.solvers);
+    free(job.games);
+    free(job.misses);
+    free(job.guesses);
+    pattern_index_free(&patterns);
+    dictionary_free(&dictionary);
+    return status;
+}
+
+static void solve_usage(const char* program) {
+    fprintf(stderr, "usage: %s [--strategy NAME|all] [--threads N] [--hardest K] [words.txt|words.bin ...]\n", program);
+    fprintf(stderr, "strategies:\n");
+    for (int i = 0; i < solver_strategy_count; i++) {
+        fprintf(stderr, "  %-11s %s\n", solver_strategies[i].name, solver_strategies[i].description);
+    }
+}
+
+int main(int argc, char** argv) {
+    const SolverStrategy* only = solver_strategy_find("entropy");
+    int threads = 0;
+    int hardest = SOLVE_DEFAULT_HARDEST;
+    const char* files[64];
+    int file_count = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--strategy") == 0 && i + 1 < argc) {
+            i++;
+            only = strcmp(argv[i], "all") == 0 ? NULL : solver_strategy_find(argv[i]);
+            if (only == NULL && strcmp(argv[i], "all") != 0) {
+                fprintf(stderr, "ERROR: Unknown strategy %s\n", argv[i]);
+                solve_usage(argv[0]);
+                return 2;
+            }
+        } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threads = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--hardest") == 0 && i + 1 < argc) {
+            hardest = atoi(argv[++i]);
+        } else if (argv[i][0] == '-' || file_count == (int)(sizeof(files) / sizeof(files[0]))) {
+            solve_usage(argv[0]);
+            return 2;
+        } else {
+            files[file_count++] = argv[i];
+        }
+    }
+    if (file_count == 0) {
+        files[file_count++] = "words_en.txt";
+        files[file_count++] = "words_ro.txt";
+    }
+
+    ParallelPool* pool = parallel_pool_create(threads);
+    if (pool == NULL) {
+        return 1;
+    }
+    int status = 0;
+    for (int i = 0; i < file_count; i++) {
+        status |= solve_dictionary(files[i], only, pool, hardest);
+    }
+    parallel_pool_destroy(pool);
+    return status;
+}
@@ -0,0 +1,572 @@
+// tune.c - Monte Carlo pentru constantele de echilibru din rules.h: urcari in hard mode si meciuri versus
+//          simulate pe regulile adevarate (rules.c, ceas manual), pe o grila de valori
+//
+//   hangman_tune [--dictionary words_en.txt] [--runs 100000] [--threads N] [--strategy candidates] [--think-ms 3000]
+//                [--hard-time 30,40,50] [--win-bonus 10,20,30]
+//                [--versus-time 20,30,45] [--guess-bonus 10,15,20] [--words-to-win 5,7,9]
+//
+// Jucatorii simulati au o indemanare (cat de des ignora strategia si incearca o litera oarecare, vezi
+// TUNE_SKILLS) si o viteza: fiecare are un timp median pe litera (lognormal in jurul lui --think-ms),
+// iar fiecare litera ia lognormal in jurul medianei lui. Partida unui jucator pe un cuvant nu depinde de
+// ceasuri, asa ca e calculata o data (solver.c, pe toate nucleele) ca sir de litere pentru fiecare
+// cuvant si indemanare; simularile doar o rejoaca prin rules_hard_* / rules_versus_* cu RulesBalance-ul
+// punctului din grila. Fiecare simulare are seed-ul ei, deci rezultatele nu depind de numarul de fire.
+//
+// Hard mode: procentul care termina urcarea (lungimea INITIAL_WORD_LENGTH -> MAX_GAME_WORD_LENGTH, sau
+// nivelurile de dificultate daca exista .scores-ul dictionarului, ca in joc) pe indemanari, cuvintele ghicite in medie si durata (p10/p50/p90).
+// Versus: cum se termina meciurile (cuvinte, timp, greseli), rundele, durata si cat de des castiga
+// jucatorul mai bun cand indemanarile difera.
+// WRONG_GUESS_BONUS_WIN nu e in grila: rules_hard_reset pune wrong_guesses = 0 la fiecare cuvant, asa ca
+// bonusul nu schimba niciodata rezultatul unei urcari.
+//
+// Build: cmake -S . -B build && cmake --build build --target hangman_tune
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+
+#include "dictionary.h"
+#include "pattern_index.h"
+#include "parallel.h"
+#include "rules.h"
+#include "solver.h"
+
+#define TUNE_MAX_GRID_VALUES 16
+#define TUNE_GRAIN_WORDS 64
+#define TUNE_GRAIN_RUNS 256
+#define TUNE_HISTOGRAM_STEP_MS 5000     // duratele, in bin-uri de 5 s
+#define TUNE_HISTOGRAM_BINS 720         // pana la o ora; restul in ultimul bin
+#define TUNE_MAX_STEPS 100000           // siguranta: o simulare nu poate depasi atatea litere
+#define TUNE_PLAYER_SPREAD 0.35         // sigma lognormal a medianei intre jucatori
+#define TUNE_GUESS_SPREAD 0.5           // sigma lognormal a unei litere in jurul medianei jucatorului
+
+typedef struct TuneSkill {
+    const char* name;
+    int blunder_percent;
+} TuneSkill;
+
+static const TuneSkill TUNE_SKILLS[] = {
+    {"novice", 40},
+    {"casual", 20},
+    {"skilled", 8},
+    {"expert", 0},
+};
+#define TUNE_SKILL_COUNT ((int)(sizeof(TUNE_SKILLS) / sizeof(TUNE_SKILLS[0])))
+
+typedef struct TuneGrid {
+    int values[TUNE_MAX_GRID_VALUES];
+    int count;
+} TuneGrid;
+
+typedef struct TuneStats {
+    long runs[TUNE_SKILL_COUNT];        // hard: urcari pe indemanare
+    long completed[TUNE_SKILL_COUNT];   // hard: urcari terminate
+    long words;                         // hard: cuvinte ghicite; versus: runde jucate
+    long ended_by_words;                // versus
+    long ended_by_time;
+    long ended_by_guesses;
+    long mismatched;                    // versus: meciuri intre indemanari diferite
+    long stronger_won;
+    long durations[TUNE_HISTOGRAM_BINS];
+} TuneStats;
+
+typedef struct TuneContext {
+    const Dictionary* dictionary;
+    Solver* solvers;                // unul pe worker, doar pentru sirurile de litere
+    HangmanGame* games;
+    char* traces;                   // [skill][cuvant][ALPHABET_SIZE]: literele incercate, in ordine
+    int* word_table;                // cuvant -> indice in dictionar, open addressing
+    uint32_t word_table_mask;
+    TuneStats* stats;               // unul pe worker, unite dupa fiecare punct din grila
+    RulesBalance balance;
+    double think_ms;
+    uint32_t salt;                  // separa seed-urile urcarilor de ale meciurilor
+} TuneContext;
+
+static double tune_now_seconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+}
+
+static bool tune_parse_grid(const char* text, TuneGrid* grid) {
+    grid->count = 0;
+    while (*text) {
+        char* end;
+        long value = strtol(text, &end, 10);
+        if (end == text || value < 0 || grid->count == TUNE_MAX_GRID_VALUES) {
+            return false;
+        }
+        grid->values[grid->count++] = (int)value;
+        text = (*end == ',') ? end + 1 : end;
+        if (*end != ',' && *end != '\0') {
+            return false;
+        }
+    }
+    return grid->count > 0;
+}
+
+// ---------------- partidele pe cuvinte ----------------
+
+static char* tune_trace(const TuneContext* context, int skill, int word) {
+    return context->traces + ((size_t)skill * context->dictionary->word_count + (size_t)word) * ALPHABET_SIZE;
+}
+
+static void tune_trace_words(void* data, int begin, int end, int worker) {
+    TuneContext* context = (TuneContext*)data;
+    Solver* solver = &context->solvers[worker];
+    for (int i = begin; i < end; i++) {
+        for (int skill = 0; skill < TUNE_SKILL_COUNT; skill++) {
+            solver->blunder_percent = TUNE_SKILLS[skill].blunder_percent;
+            solver_play_word(solver, &context->games[worker], dictionary_word(context->dictionary, i),
+                             ((uint32_t)i * TUNE_SKILL_COUNT + (uint32_t)skill) * 2654435761u + 1u, tune_trace(context, skill, i));
+        }
+    }
+}
+
+// HangmanGame.word e o copie: indicele cuvantului se gaseste printr-o tabela de hash peste dictionar
+static uint32_t tune_hash_word(const char* word) {
+    uint32_t hash = 2166136261u; // FNV-1a
+    for (; *word; word++) {
+        hash = (hash ^ (unsigned char)*word) * 16777619u;
+    }
+    return hash;
+}
+
+static bool tune_build_word_table(TuneContext* context) {
+    const Dictionary* dictionary = context->dictionary;
+    uint32_t size = 16;
+    while (size < 2u * (uint32_t)dictionary->word_count) {
+        size *= 2;
+    }
+    context->word_table = (int*)malloc((size_t)size * sizeof(int));
+    if (!context->word_table) {
+        return false;
+    }
+    memset(context->word_table, 0xFF, (size_t)size * sizeof(int)); // -1 = slot liber
+    context->word_table_mask = size - 1;
+    for (int i = 0; i < dictionary->word_count; i++) {
+        const char* word = dictionary_word(dictionary, i);
+        uint32_t slot = tune_hash_word(word) & context->word_table_mask;
+        while (context->word_table[slot] >= 0 && strcmp(dictionary_word(dictionary, context->word_table[slot]), word) != 0) {
+            slot = (slot + 1) & context->word_table_mask;
+        }
+        if (context->word_table[slot] < 0) {
+            context->word_table[slot] = i; // la duplicate ramane primul
+        }
+    }
+    return true;
+}
+
+static int tune_word_id(const TuneContext* context, const char* word) {
+    uint32_t slot = tune_hash_word(word) & context->word_table_mask;
+    while (context->word_table[slot] >= 0) {
+        if (strcmp(dictionary_word(context->dictionary, context->word_table[slot]), word) == 0) {
+            return context->word_table[slot];
+        }
+        slot = (slot + 1) & context->word_table_mask;
+    }
+    return -1;
+}
+
+// ---------------- jucatorii simulati ----------------
+
+typedef struct TunePlayer {
+    int skill;
+    double median_ms;
+} TunePlayer;
+
+static double tune_uniform(uint32_t* state) {
+    return (rules_xorshift_rand(state) + 0.5) / 4294967296.0;
+}
+
+static double tune_lognormal(uint32_t* state, double median, double sigma) {
+    // Box-Muller
+    double normal = sqrt(-2.0 * log(tune_uniform(state))) * cos(2.0 * M_PI * tune_uniform(state));
+    return median * exp(sigma * normal);
+}
+
+static TunePlayer tune_player(const TuneContext* context, uint32_t* state) {
+    TunePlayer player;
+    player.skill = (int)(rules_xorshift_rand(state) % TUNE_SKILL_COUNT);
+    player.median_ms = tune_lognormal(state, context->think_ms, TUNE_PLAYER_SPREAD);
+    return player;
+}
+
+// urmatoarea litera a jucatorului pe cuvantul lui si timpul in care o gaseste
+static char tune_next_letter(const TuneContext* context, const TunePlayer* player, const HangmanGame* hangman,
+                             uint32_t* state, long* now) {
+    *now += (long)tune_lognormal(state, player->median_ms, TUNE_GUESS_SPREAD);
+    int guessed = __builtin_popcount(hangman->guessed_mask);
+    int word = tune_word_id(context, hangman->word);
+    if (guessed >= ALPHABET_SIZE || word < 0) {
+        return '\0'; // cuvant din afara dictionarului (ex. "DEFAULT" din versus): jucatorul doar pierde timp
+    }
+    return tune_trace(context, player->skill, word)[guessed];
+}
+
+// Aceleasi numere aleatoare in fiecare punct din grila (acelasi jucator, aceleasi cuvinte, pana unde
+// regulile le despart): diferentele dintre randuri vin din constante, nu din zgomot.
+static uint32_t tune_seed(const TuneContext* context, int run) {
+    uint32_t seed = context->salt ^ ((uint32_t)run * 2654435761u);
+    return seed ? seed : 1;
+}
+
+static void tune_record_duration(TuneStats* stats, long duration_ms) {
+    long bin = duration_ms / TUNE_HISTOGRAM_STEP_MS;
+    stats->durations[bin < TUNE_HISTOGRAM_BINS ? bin : TUNE_HISTOGRAM_BINS - 1]++;
+}
+
+// ---------------- hard mode ----------------
+
+static void tune_hard_climbs(void* data, int begin, int end, int worker) {
+    TuneContext* context = (TuneContext*)data;
+    TuneStats* stats = &context->stats[worker];
+    for (int run = begin; run < end; run++) {
+        uint32_t state = tune_seed(context, run);
+        long now = 0;
+        RulesEnv env = {rules_manual_clock, &now, rules_xorshift_rand, &state, &context->balance};
+        TunePlayer player = tune_player(context, &state);
+        HangmanGame hangman;
+        memset(&hangman, 0, sizeof(hangman));
+        hangman.dictionary = context->dictionary;
+
+        rules_hard_init(&hangman, &env);
+        for (int step = 0; step < TUNE_MAX_STEPS && !hangman.game_over; step++) {
+            if (hangman.win) {
+                // cuvant ghicit: dupa mesaj, rules_hard_tick trece la lungimea urmatoare (sau castigul final)
+                stats->words++;
+                now = hangman.round_won_display_time + ROUND_WIN_DISPLAY_DURATION;
+                rules_hard_tick(&hangman, &env);
+                continue;
+            }
+            char letter = tune_next_letter(context, &player, &hangman, &state, &now);
+            rules_hard_tick(&hangman, &env); // timpul trecut cat s-a gandit poate pierde runda
+            if (!hangman.game_over && letter != '\0') {
+                rules_hard_guess(&hangman, &env, letter);
+            }
+        }
+        stats->runs[player.skill]++;
+        stats->completed[player.skill] += hangman.game_over && hangman.win;
+        tune_record_duration(stats, now);
+    }
+}
+
+// ---------------- versus ----------------
+
+static void tune_versus_matches(void* data, int begin, int end, int worker) {
+    TuneContext* context = (TuneContext*)data;
+    TuneStats* stats = &context->stats[worker];
+    for (int run = begin; run < end; run++) {
+        uint32_t state = tune_seed(context, run);
+        long now = 0;
+        RulesEnv env = {rules_manual_clock, &now, rules_xorshift_rand, &state, &context->balance};
+        TunePlayer players[2] = {tune_player(context, &state), tune_player(context, &state)};
+        VersusHangman versus;
+        memset(&versus, 0, sizeof(versus));
+        versus.player1.dictionary = context->dictionary;
+        versus.player2.dictionary = context->dictionary;
+
+        rules_versus_reset(&versus, &env, true);
+        long rounds = 1;
+        for (int step = 0; step < TUNE_MAX_STEPS && !rules_versus_game_over(&versus); step++) {
+            if (rules_versus_round_over(&versus)) {
+                now = versus.round_over_display_time + VERSUS_ROUND_OVER_DISPLAY_MS;
+                rules_versus_reset(&versus, &env, false);
+                rounds++;
+                continue;
+            }
+            int turn = versus.current_turn == PLAYER_1 ? 0 : 1;
+            HangmanGame* active = turn == 0 ? &versus.player1 : &versus.player2;
+            char letter = tune_next_letter(context, &players[turn], active, &state, &now);
+            rules_versus_tick(&versus, &env);
+            if (!rules_versus_game_over(&versus) && letter != '\0') {
+                rules_versus_guess(&versus, &env, letter);
+            }
+        }
+
+        // castigatorul: cine a ajuns la words_to_win, altfel adversarul celui ramas fara timp sau incercari
+        int winner;
+        if (versus.player1.words_guessed_count >= versus.words_to_win) {
+            winner = 0;
+            stats->ended_by_words++;
+        } else if (versus.player2.words_guessed_count >= versus.words_to_win) {
+            winner = 1;
+            stats->ended_by_words++;
+        } else {
+            int loser = (versus.player1.time_left_ms <= 0 || versus.player1.wrong_guesses >= MAX_WRONG_GUESSES) ? 0 : 1;
+            const HangmanGame* lost = loser == 0 ? &versus.player1 : &versus.player2;
+            if (lost->time_left_ms <= 0) {
+                stats->ended_by_time++;
+            } else {
+                stats->ended_by_guesses++;
+            }
+            winner = 1 - loser;
+        }
+        stats->words += rounds;
+        if (players[0].skill != players[1].skill) {
+            stats->mismatched++;
+            stats->stronger_won += players[winner].skill > players[1 - winner].skill;
+        }
+        tune_record_duration(stats, now);
+    }
+}
+
+// ---------------- raport ----------------
+
+static void tune_merge_stats(TuneContext* context, int workers, TuneStats* total) {
+    memset(total, 0, sizeof(TuneStats));
+    for (int w = 0; w < workers; w++) {
+        const TuneStats* stats = &context->stats[w];
+        for (int s = 0; s < TUNE_SKILL_COUNT; s++) {
+            total->runs[s] += stats->runs[s];
+            total->completed[s] += stats->completed[s];
+        }
+        total->words += stats->words;
+        total->ended_by_words += stats->ended_by_words;
+        total->ended_by_time += stats->ended_by_time;
+        total->ended_by_guesses += stats->ended_by_guesses;
+        total->mismatched += stats->mismatched;
+        total->stronger_won += stats->stronger_won;
+        for (int b = 0; b < TUNE_HISTOGRAM_BINS; b++) {
+            total->durations[b] += stats->durations[b];
+        }
+    }
+    memset(context->stats, 0, (size_t)workers * sizeof(TuneStats));
+}
+
+// durata (s) sub care se termina fractiunea data din simulari, de la mijlocul bin-ului
+static double tune_percentile_seconds(const TuneStats* stats, long runs, double fraction) {
+    long target = (long)ceil(fraction * runs);
+    long seen = 0;
+    for (int b = 0; b < TUNE_HISTOGRAM_BINS; b++) {
+        seen += stats->durations[b];
+        if (seen >= target && seen > 0) {
+            return (b + 0.5) * TUNE_HISTOGRAM_STEP_MS / 1000.0;
+        }
+    }
+    return TUNE_HISTOGRAM_BINS * TUNE_HISTOGRAM_STEP_MS / 1000.0;
+}
+
+static double tune_percent(long part, long whole) {
+    return whole > 0 ? 100.0 * part / whole : 0.0;
+}
+
+static void tune_run_hard(TuneContext* context, ParallelPool* pool, int runs, const TuneGrid* times,
+                          const TuneGrid* win_bonuses) {
+    if (rules_has_difficulty(context->dictionary)) {
+        printf("\nhard mode: %d climbs per setting (difficulty level 1 -> %d), players split evenly over skills\n",
+               runs, DIFFICULTY_LEVELS);
+    } else {
+        printf("\nhard mode: %d climbs per setting (length %d -> %d), players split evenly over skills\n",
+               runs, INITIAL_WORD_LENGTH, MAX_GAME_WORD_LENGTH);
+    }
+    printf("  time  win+s | complete%%");
+    for (int s = 0; s < TUNE_SKILL_COUNT; s++) {
+        printf(" %8s", TUNE_SKILLS[s].name);
+    }
+    printf(" | words |   p10s   p50s   p90s\n");
+
+    int workers = parallel_pool_size(pool);
+    context->salt = 0x48415244u;
+    for (int t = 0; t < times->count; t++) {
+        for (int w = 0; w < win_bonuses->count; w++) {
+            context->balance = rules_default_balance;
+            context->balance.initial_hard_mode_time_seconds = times->values[t];
+            context->balance.time_bonus_win_seconds = win_bonuses->values[w];
+            parallel_for(pool, runs, TUNE_GRAIN_RUNS, tune_hard_climbs, context);
+
+            TuneStats total;
+            tune_merge_stats(context, workers, &total);
+            long all_runs = 0;
+            long all_completed = 0;
+            for (int s = 0; s < TUNE_SKILL_COUNT; s++) {
+                all_runs += total.runs[s];
+                all_completed += total.completed[s];
+            }
+            bool current = context->balance.initial_hard_mode_time_seconds == INITIAL_HARD_MODE_TIME_SECONDS &&
+                           context->balance.time_bonus_win_seconds == TIME_BONUS_WIN_SECONDS;
+            printf("%c %4d  %5d | %8.2f ", current ? '*' : ' ', times->values[t], win_bonuses->values[w],
+                   tune_percent(all_completed, all_runs));
+            for (int s = 0; s < TUNE_SKILL_COUNT; s++) {
+                printf(" %8.2f", tune_percent(total.completed[s], total.runs[s]));
+            }
+            printf(" | %5.2f | %6.0f %6.0f %6.0f\n", all_runs ? (double)total.words / all_runs : 0.0,
+                   tune_percentile_seconds(&total, all_runs, 0.1), tune_percentile_seconds(&total, all_runs, 0.5),
+                   tune_percentile_seconds(&total, all_runs, 0.9));
+        }
+    }
+}
+
+static void tune_run_versus(TuneContext* context, ParallelPool* pool, int runs, const TuneGrid* times,
+                            const TuneGrid* guess_bonuses, const TuneGrid* words_to_win) {
+    printf("\nversus: %d matches per setting, both players drawn at random\n", runs);
+    printf("  time  hit+s  words | ended by: words%%  time%%  guesses%% | rounds | better wins%% |   p10s   p50s   p90s\n");
+
+    int workers = parallel_pool_size(pool);
+    context->salt = 0x56455253u;
+    for (int t = 0; t < times->count; t++) {
+        for (int b = 0; b < guess_bonuses->count; b++) {
+            for (int w = 0; w < words_to_win->count; w++) {
+                context->balance = rules_default_balance;
+                context->balance.initial_versus_mode_time_seconds = times->values[t];
+                context->balance.time_bonus_guess_seconds = guess_bonuses->values[b];
+                context->balance.words_to_win_versus_mode = words_to_win->values[w];
+                parallel_for(pool, runs, TUNE_GRAIN_RUNS, tune_versus_matches, context);
+
+                TuneStats total;
+                tune_merge_stats(context, workers, &total);
+                long matches = total.ended_by_words + total.ended_by_time + total.ended_by_guesses;
+                bool current = context->balance.initial_versus_mode_time_seconds == INITIAL_VERSUS_MODE_TIME_SECONDS &&
+                               context->balance.time_bonus_guess_seconds == TIME_BONUS_GUESS_SECONDS &&
+                               context->balance.words_to_win_versus_mode == WORDS_TO_WIN_VERSUS_MODE;
+                printf("%c %4d  %5d  %5d |           %6.2f %6.2f %9.2f | %6.2f | %12.2f | %6.0f %6.0f %6.0f\n",
+                       current ? '*' : ' ', times->values[t], guess_bonuses->values[b], words_to_win->values[w],
+                       tune_percent(total.ended_by_words, matches), tune_percent(total.ended_by_time, matches),
+                       tune_percent(total.ended_by_guesses, matches), matches ? (double)total.words / matches : 0.0,
+                       tune_percent(total.stronger_won, total.mismatched),
+                       tune_percentile_seconds(&total, matches, 0.1), tune_percentile_seconds(&total, matches, 0.5),
+                       tune_percentile_seconds(&total, matches, 0.9));
+            }
+        }
+    }
+}
+
+static void tune_usage(const char* program) {
+    fprintf(stderr, "usage: %s [--dictionary words.txt|words.bin] [--runs N] [--threads N] [--strategy NAME] [--think-ms MS]\n"
+                    "          [--hard-time S,..] [--win-bonus S,..]\n"
+                    "          [--versus-time S,..] [--guess-bonus S,..] [--words-to-win N,..]\n", program);
+}
+
+int main(int argc, char** argv) {
+    const char* filename = "words_en.txt";
+    const SolverStrategy* strategy = solver_strategy_find("candidates");
+    int runs = 100000;
+    int threads = 0;
+    double think_ms = 3000.0;
+    TuneGrid hard_times, win_bonuses, versus_times, guess_bonuses, words_to_win;
+    tune_parse_grid("30,40,50", &hard_times);
+    tune_parse_grid("10,20,30", &win_bonuses);
+    tune_parse_grid("20,30,45", &versus_times);
+    tune_parse_grid("10,15,20", &guess_bonuses);
+    tune_parse_grid("5,7,9", &words_to_win);
+
+    for (int i = 1; i < argc; i++) {
+        bool has_value = i + 1 < argc;
+        const char* value = has_value ? argv[i + 1] : "";
+        bool ok = has_value;
+        if (strcmp(argv[i], "--dictionary") == 0) {
+            filename = value;
+        } else if (strcmp(argv[i], "--runs") == 0) {
+            runs = atoi(value);
+            ok = ok && runs > 0;
+        } else if (strcmp(argv[i], "--threads") == 0) {
+            threads = atoi(value);
+        } else if (strcmp(argv[i], "--think-ms") == 0) {
+            think_ms = atof(value);
+            ok = ok && think_ms > 0;
+        } else if (strcmp(argv[i], "--strategy") == 0) {
+            strategy = solver_strategy_find(value);
+            ok = ok && strategy != NULL;
+        } else if (strcmp(argv[i], "--hard-time") == 0) {
+            ok = ok && tune_parse_grid(value, &hard_times);
+        } else if (strcmp(argv[i], "--win-bonus") == 0) {
+            ok = ok && tune_parse_grid(value, &win_bonuses);
+        } else if (strcmp(argv[i], "--versus-time") == 0) {
+            ok = ok && tune_parse_grid(value, &versus_times);
+        } else if (strcmp(argv[i], "--guess-bonus") == 0) {
+            ok = ok && tune_parse_grid(value, &guess_bonuses);
+        } else if (strcmp(argv[i], "--words-to-win") == 0) {
+            ok = ok && tune_parse_grid(value, &words_to_win);
+        } else {
+            ok = false;
+        }
+        if (!ok) {
+            tune_usage(argv[0]);
+            return 2;
+        }
+        i++;
+    }
+
+    Dictionary dictionary;
+    size_t length = strlen(filename);
+    bool loaded;
+    if (length > 4 && strcmp(filename + length - 4, ".txt") == 0) {
+        char binary[4096];
+        snprintf(binary, sizeof(binary), "%.*s.bin", (int)(length - 4), filename);
+        loaded = dictionary_load(&dictionary, binary, filename);
+    } else {
+        loaded = dictionary_load_binary(&dictionary, filename);
+    }
+    if (!loaded || dictionary.word_count == 0) {
+        fprintf(stderr, "ERROR: Cannot load %s\n", filename);
+        return 1;
+    }
+    // ca jocul: hard mode urca pe niveluri de dificultate daca scorurile dictionarului exista
+    const char* dot = strrchr(filename, '.');
+    char scores[4096];
+    snprintf(scores, sizeof(scores), "%.*s.scores", (dot && strchr(dot, '/') == NULL) ? (int)(dot - filename) : (int)length, filename);
+    dictionary_load_difficulty(&dictionary, scores);
+
+    ParallelPool* pool = parallel_pool_create(threads);
+    if (pool == NULL) {
+        dictionary_free(&dictionary);
+        return 1;
+    }
+    int workers = parallel_pool_size(pool);
+    PatternIndex patterns;
+    pattern_index_init(&patterns, &dictionary);
+    solver_prepare_patterns(&patterns);
+
+    TuneContext context;
+    memset(&context, 0, sizeof(context));
+    context.dictionary = &dictionary;
+    context.think_ms = think_ms;
+    context.solvers = (Solver*)calloc((size_t)workers, sizeof(Solver));
+    context.games = (HangmanGame*)calloc((size_t)workers, sizeof(HangmanGame));
+    context.stats = (TuneStats*)calloc((size_t)workers, sizeof(TuneStats));
+    context.traces = (char*)malloc((size_t)TUNE_SKILL_COUNT * dictionary.word_count * ALPHABET_SIZE);
+    int status = 0;
+    if (!context.solvers || !context.games || !context.stats || !context.traces || !tune_build_word_table(&context)) {
+        fprintf(stderr, "ERROR: Out of memory for %d words\n", dictionary.word_count);
+        status = 1;
+    } else {
+        double start = tune_now_seconds();
+        for (int w = 0; w < workers; w++) {
+            solver_init(&context.solvers[w], strategy, &patterns);
+            context.games[w].dictionary = &dictionary;
+        }
+        parallel_for(pool, dictionary.word_count, TUNE_GRAIN_WORDS, tune_trace_words, &context);
+        for (int w = 0; w < workers; w++) {
+            solver_free(&context.solvers[w]);
+        }
+        printf("%s: %d words, strategy %s, skills", filename, dictionary.word_count, strategy->name);
+        for (int s = 0; s < TUNE_SKILL_COUNT; s++) {
+            printf(" %s (%d%% random letters)", TUNE_SKILLS[s].name, TUNE_SKILLS[s].blunder_percent);
+        }
+        printf(", median %.0f ms per letter, %d threads; games played in %.1f s\n", think_ms, workers,
+               tune_now_seconds() - start);
+        printf("* = the values compiled into rules.h\n");
+
+        start = tune_now_seconds();
+        tune_run_hard(&context, pool, runs, &hard_times, &win_bonuses);
+        tune_run_versus(&context, pool, runs, &versus_times, &guess_bonuses, &words_to_win);
+        long simulations = (long)runs * (hard_times.count * win_bonuses.count +
+                                         versus_times.count * guess_bonuses.count * words_to_win.count);
+        double seconds = tune_now_seconds() - start;
+        printf("\n%ld simulations in %.1f s (%.0f/s)\n", simulations, seconds, simulations / (seconds > 0 ? seconds : 1e-9));
+    }
+
+    free(context.solvers);
+    free(context.games);
+    free(context.stats);
+    free(context.traces);
+    free(context.word_table);
+    pattern_index_free(&patterns);
+    parallel_pool_destroy(pool);
+    dictionary_free(&dictionary);
+    return status;
+}
@@ -0,0 +1,230 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+
+#include "versus_bot.h"
+#include "log.h"
+
+#define VERSUS_BOT_ALL_LETTERS ((1u << ALPHABET_SIZE) - 1)
+#define VERSUS_BOT_COMMON_LETTERS "EARITNOSLCUDPMHGBFYVWKZXJQ" // cand nu mai are candidati (cuvant din afara indexului)
+#define VERSUS_BOT_BLUNDER_CHOICES 6   // o greseala = una din primele litere comune neincercate
+
+// per VersusBotStrength: cat de des ignora hint-ul (%) si timpul de baza de gandire (ms, +-50%)
+static const int versus_bot_blunder_percent[VERSUS_BOT_STRENGTH_COUNT] = {0, 35, 12, 0};
+static const int versus_bot_base_think_ms[VERSUS_BOT_STRENGTH_COUNT] = {0, 2200, 1500, 900};
+static const char* versus_bot_names[VERSUS_BOT_STRENGTH_COUNT] = {"Player 2", "CPU (easy)", "CPU (medium)", "CPU (hard)"};
+
+static Uint32 versus_bot_event_type = 0; // inregistrat o data, la primul bot
+
+const char* versus_bot_strength_name(VersusBotStrength strength) {
+    if (strength < 0 || strength >= VERSUS_BOT_STRENGTH_COUNT) {
+        return versus_bot_names[VERSUS_BOT_OFF];
+    }
+    return versus_bot_names[strength];
+}
+
+static uint32_t versus_bot_random(VersusBot* bot) {
+    // xorshift32: firul botului nu atinge rand() (nu e thread-safe si ar schimba secventa jocului)
+    uint32_t x = bot->rand_state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    bot->rand_state = x;
+    return x;
+}
+
+// litera de incercat ('A'-'Z', '\0' daca le-a incercat pe toate); *candidates = cuvintele inca posibile
+static char versus_bot_choose(VersusBot* bot, const HangmanGame* player, VersusBotStrength strength, int* candidates) {
+    // la inceputul rundei litera vine din cartea de deschideri, fara calcul pe candidati
+    int best = opening_book_letter(bot->hint.book, player, candidates);
+    if (best < 0) {
+        best = hint_best_letter(&bot->hint, player);
+        *candidates = best >= 0 ? bot->hint.candidate_count : 0;
+    }
+    if (best >= 0 && (int)(versus_bot_random(bot) % 100) >= versus_bot_blunder_percent[strength]) {
+        return (char)('A' + best);
+    }
+
+    // fara candidati: prima litera comuna; greseala: una din primele VERSUS_BOT_BLUNDER_CHOICES
+    char choices[VERSUS_BOT_BLUNDER_CHOICES];
+    int choice_count = 0;
+    for (const char* c = VERSUS_BOT_COMMON_LETTERS; *c && choice_count < VERSUS_BOT_BLUNDER_CHOICES; c++) {
+        if (!(player->guessed_mask & (1u << (*c - 'A')))) {
+            choices[choice_count++] = *c;
+        }
+    }
+    if (choice_count == 0) {
+        return '\0';
+    }
+    return best < 0 ? choices[0] : choices[versus_bot_random(bot) % (uint32_t)choice_count];
+}
+
+// cat "gandeste" inainte sa puna litera: baza dupa putere, mai mult cand mai sunt multe cuvinte posibile,
+// limitat de ceasul lui si de VERSUS_BOT_MAX_THINK_MS
+static Uint32 versus_bot_think_ms(VersusBot* bot, const HangmanGame* player, VersusBotStrength strength, int candidates) {
+    int base = versus_bot_base_think_ms[strength];
+    long think = base / 2 + (long)(versus_bot_random(bot) % (uint32_t)(base + 1));
+    think += (long)(VERSUS_BOT_MS_PER_BIT * log2((double)candidates + 1.0));
+    if (think < VERSUS_BOT_MIN_THINK_MS) {
+        think = VERSUS_BOT_MIN_THINK_MS;
+    }
+    long clock_limit = player->time_left_ms / VERSUS_BOT_CLOCK_SHARE;
+    if (think > clock_limit) {
+        think = clock_limit;
+    }
+    if (think > VERSUS_BOT_MAX_THINK_MS) {
+        think = VERSUS_BOT_MAX_THINK_MS;
+    }
+    return think > 0 ? (Uint32)think : 0;
+}
+
+static void versus_bot_post(VersusBot* bot, unsigned int id, char letter) {
+    SDL_Event event;
+    memset(&event, 0, sizeof(event));
+    event.type = bot->event_type;
+    event.user.code = (Sint32)id;
+    event.user.data1 = (void*)(intptr_t)letter;
+    if (SDL_PushEvent(&event) < 0) {
+        LOG_ERROR(LOG_CAT_VERSUS, "versus_bot_post: SDL_PushEvent failed: %s", SDL_GetError());
+    }
+}
+
+static int versus_bot_thread(void* data) {
+    VersusBot* bot = (VersusBot*)data;
+    SDL_LockMutex(bot->mutex);
+    for (;;) {
+        while (!bot->stop && !bot->has_request) {
+            SDL_CondWait(bot->wake, bot->mutex);
+        }
+        if (bot->stop) {
+            break;
+        }
+        unsigned int id = bot->request_id;
+        HangmanGame player = bot->request;
+        VersusBotStrength strength = bot->strength;
+        bot->has_request = false;
+        SDL_UnlockMutex(bot->mutex);
+
+        // calculul e pe copie, fara mutex: firul principal poate cere/anula intre timp
+        Uint32 started = SDL_GetTicks();
+        int candidates = 0;
+        char letter = versus_bot_choose(bot, &player, strength, &candidates);
+        Uint32 think = versus_bot_think_ms(bot, &player, strength, candidates);
+        LOG_DEBUG(LOG_CAT_VERSUS, "versus_bot_thread: %s plays %c after %u ms (%d candidates, computed in %u ms).",
+                  versus_bot_strength_name(strength), letter ? letter : '-', think, candidates, SDL_GetTicks() - started);
+
+        SDL_LockMutex(bot->mutex);
+        // restul timpului de gandire; oprirea, anularea sau o cerere noua il intrerup
+        Uint32 elapsed = SDL_GetTicks() - started;
+        while (!bot->stop && bot->wanted_id == id && elapsed < think) {
+            SDL_CondWaitTimeout(bot->wake, bot->mutex, think - elapsed);
+            elapsed = SDL_GetTicks() - started;
+        }
+        if (!bot->stop && bot->wanted_id == id && letter != '\0') {
+            versus_bot_post(bot, id, letter);
+        }
+    }
+    SDL_UnlockMutex(bot->mutex);
+    return 0;
+}
+
+VersusBot* versus_bot_create(PatternIndex* patterns, const OpeningBook* book) {
+    if (patterns == NULL) {
+        LOG_ERROR(LOG_CAT_VERSUS, "versus_bot_create: No pattern index.");
+        return NULL;
+    }
+    if (versus_bot_event_type == 0) {
+        versus_bot_event_type = SDL_RegisterEvents(1);
+        if (versus_bot_event_type == (Uint32)-1) {
+            versus_bot_event_type = 0;
+            LOG_ERROR(LOG_CAT_VERSUS, "versus_bot_create: No user event left: %s", SDL_GetError());
+            return NULL;
+        }
+    }
+    VersusBot* bot = (VersusBot*)calloc(1, sizeof(VersusBot));
+    if (!bot) {
+        LOG_ERROR(LOG_CAT_VERSUS, "versus_bot_create: Failed to allocate the bot.");
+        return NULL;
+    }
+    bot->event_type = versus_bot_event_type;
+    bot->rand_state = (uint32_t)SDL_GetTicks() * 2654435761u | 1u;
+    hint_init(&bot->hint, patterns);
+    hint_set_book(&bot->hint, book);
+    bot->mutex = SDL_CreateMutex();
+    bot->wake = SDL_CreateCond();
+    if (bot->mutex) {
+        bot->thread = bot->wake ? SDL_CreateThread(versus_bot_thread, "versus_bot", bot) : NULL;
+    }
+    if (!bot->thread) {
+        LOG_ERROR(LOG_CAT_VERSUS, "versus_bot_create: Failed to start the bot thread: %s", SDL_GetError());
+        versus_bot_destroy(bot);
+        return NULL;
+    }
+    return bot;
+}
+
+void versus_bot_destroy(VersusBot* bot) {
+    if (bot == NULL) {
+        return;
+    }
+    if (bot->thread) {
+        SDL_LockMutex(bot->mutex);
+        bot->stop = true;
+        SDL_CondSignal(bot->wake);
+        SDL_UnlockMutex(bot->mutex);
+        SDL_WaitThread(bot->thread, NULL);
+    }
+    if (bot->wake) {
+        SDL_DestroyCond(bot->wake);
+    }
+    if (bot->mutex) {
+        SDL_DestroyMutex(bot->mutex);
+    }
+    hint_free(&bot->hint);
+    free(bot);
+}
+
+void versus_bot_request(VersusBot* bot, const HangmanGame* player, VersusBotStrength strength) {
+    if (bot == NULL || player == NULL) {
+        return;
+    }
+    if (++bot->next_id == 0) {
+        bot->next_id = 1; // 0 inseamna "nimic asteptat"
+    }
+    bot->awaiting_id = bot->next_id;
+    SDL_LockMutex(bot->mutex);
+    bot->request = *player;
+    bot->strength = strength;
+    bot->request_id = bot->awaiting_id;
+    bot->wanted_id = bot->awaiting_id;
+    bot->has_request = true;
+    SDL_CondSignal(bot->wake);
+    SDL_UnlockMutex(bot->mutex);
+}
+
+void versus_bot_cancel(VersusBot* bot) {
+    if (bot == NULL || bot->awaiting_id == 0) {
+        return;
+    }
+    bot->awaiting_id = 0;
+    SDL_LockMutex(bot->mutex);
+    bot->wanted_id = 0;
+    bot->has_request = false;
+    SDL_CondSignal(bot->wake);
+    SDL_UnlockMutex(bot->mutex);
+}
+
+bool versus_bot_take_move(VersusBot* bot, const SDL_Event* event, char* letter) {
+    if (bot == NULL || event == NULL || event->type != bot->event_type) {
+        return false;
+    }
+    // o mutare postata chiar inainte de anulare ajunge oricum in coada; id-ul ei nu mai e cel asteptat
+    if (bot->awaiting_id == 0 || (unsigned int)event->user.code != bot->awaiting_id) {
+        return false;
+    }
+    bot->awaiting_id = 0;
+    *letter = (char)(intptr_t)event->user.data1;
+    return true;
+}
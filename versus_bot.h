@@ -0,0 +1,61 @@
+#ifndef __VERSUS_BOT__
+#define __VERSUS_BOT__
+
+#include <SDL2/SDL.h>
+#include <stdbool.h>
+#include "rules.h"
+#include "hint.h"
+
+// PLAYER_2 controlat de calculator in versus mode. Botul gandeste pe un fir separat: firul principal
+// doar copiaza HangmanGame-ul botului (versus_bot_request) si primeste mutarea inapoi ca eveniment SDL,
+// cand a trecut "timpul de gandire", deci bucla de render nu asteapta niciodata dupa bot.
+// Litera vine din hint.c (candidatii compatibili cu ce vede botul in cuvantul lui); botii mai slabi
+// aleg uneori o litera la intamplare. Cat timp firul exista, indexul pe pattern-uri al dictionarului
+// e folosit doar de el: versus mode nu il atinge, iar versus_bot_destroy se apeleaza inaintea oricarui alt mod.
+
+#define VERSUS_BOT_MIN_THINK_MS 350
+#define VERSUS_BOT_MAX_THINK_MS 4000   // limita tare pe mutare, cu tot cu calculul literei
+#define VERSUS_BOT_MS_PER_BIT 120      // gandeste mai mult cand are multi candidati (log2 din numarul lor)
+#define VERSUS_BOT_CLOCK_SHARE 6       // nu consuma mai mult de 1/6 din timpul ramas pe ceasul lui
+
+typedef enum {
+    VERSUS_BOT_OFF,      // Player 2 e om
+    VERSUS_BOT_EASY,
+    VERSUS_BOT_MEDIUM,
+    VERSUS_BOT_HARD,
+    VERSUS_BOT_STRENGTH_COUNT
+} VersusBotStrength;
+
+typedef struct VersusBot {
+    SDL_Thread* thread;
+    SDL_mutex* mutex;
+    SDL_cond* wake;
+    Uint32 event_type;            // evenimentul cu mutarea: user.code = id-ul cererii, user.data1 = litera
+
+    // sub mutex
+    bool stop;
+    bool has_request;
+    unsigned int request_id;      // cererea de luat de fir
+    unsigned int wanted_id;       // mutarea pe care o mai vrea firul principal; 0 = niciuna (anulata)
+    HangmanGame request;          // copia jocului botului de la inceputul mutarii
+    VersusBotStrength strength;
+
+    // doar pe firul botului
+    HintState hint;
+    uint32_t rand_state;
+
+    // doar pe firul principal
+    unsigned int awaiting_id;     // mutarea asteptata acum; 0 = niciuna
+    unsigned int next_id;
+} VersusBot;
+
+VersusBot* versus_bot_create(PatternIndex* patterns, const OpeningBook* book);   // book poate fi NULL
+void versus_bot_destroy(VersusBot* bot);   // opreste si asteapta firul
+const char* versus_bot_strength_name(VersusBotStrength strength);
+// cere o mutare pentru starea data; o cerere mai veche, inca nepostata, e inlocuita
+void versus_bot_request(VersusBot* bot, const HangmanGame* player, VersusBotStrength strength);
+void versus_bot_cancel(VersusBot* bot);    // o mutare deja pe drum va fi ignorata
+// true daca event e mutarea asteptata acum; atunci *letter = litera ('A'-'Z')
+bool versus_bot_take_move(VersusBot* bot, const SDL_Event* event, char* letter);
+
+#endif // __VERSUS_BOT__
@@ -10,8 +10,8 @@
 #include "versus_mode.h"
 #include "normal_mode.h"
 #include "interface.h"
-
-#define WORDLIST_FILENAME "words.txt"
+#include "dictionary_cache.h"
+#include "log.h"
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -22,7 +22,7 @@ void versus_mode_init(Game* game) {
     srand(time(NULL));
     game->versus_data = (VersusHangman*)calloc(1, sizeof(VersusHangman));
     if (game->versus_data == NULL) {
-        fprintf(stderr, "ERROR: versus_mode_init: Failed to allocate memory for VersusGameData.\n");
+        LOG_ERROR(LOG_CAT_VERSUS, "versus_mode_init: Failed to allocate memory for VersusGameData.");
         return;
     }
 
@@ -32,84 +32,34 @@ void versus_mode_init(Game* game) {
     game->versus_data->player1.words_guessed_count = 0;
 
     if (!normal_mode_load_words_from_file(&game->versus_data->player1, game->current_language)) {
-        fprintf(stderr, "ERROR: versus_mode_init: Failed to load words for player 1. Exiting.\n");
+        LOG_ERROR(LOG_CAT_VERSUS, "versus_mode_init: Failed to load words for player 1. Exiting.");
         versus_mode_cleanup(game);
         return;
     }
-    SDL_Color default_key_color = {255, 255, 255, 255};
-    for (int i = 0; i < ALPHABET_SIZE; i++) {
-        char key_char[2];
-        key_char[0] = 'A' + i;
-        key_char[1] = '\0';
-        SDL_Surface* text_surface = TTF_RenderText_Blended(game->text_font, key_char, default_key_color);
-        if (text_surface) {
-            game->versus_data->player1.letter_textures[i] = SDL_CreateTextureFromSurface(game->renderer, text_surface);
-            SDL_FreeSurface(text_surface);
-        } else {
-            fprintf(stderr, "ERROR: versus_mode_init: Failed to create text surface for key %c (P1): %s\n", key_char[0], TTF_GetError());
-        }
-    }
-    for (int i = 0; i < ALPHABET_SIZE; i++) {
-        int row = i / 13;
-        int col = i % 13;
-        game->versus_data->player1.letter_rects[i].x = 180 + col * (40 + 10);
-        game->versus_data->player1.letter_rects[i].y = 650 + row * (40 + 10);
-        game->versus_data->player1.letter_rects[i].w = 40;
-        game->versus_data->player1.letter_rects[i].h = 40;
-    }
 
     memset(&game->versus_data->player2, 0, sizeof(HangmanGame));
     game->versus_data->player2.words_guessed_count = 0;
-    game->versus_data->player2.word_list_dynamic = game->versus_data->player1.word_list_dynamic;
-    game->versus_data->player2.word_count_dynamic = game->versus_data->player1.word_count_dynamic;
-
-    for (int i = 0; i < ALPHABET_SIZE; i++) {
-        char key_char[2];
-        key_char[0] = 'A' + i;
-        key_char[1] = '\0';
-        SDL_Surface* text_surface = TTF_RenderText_Blended(game->text_font, key_char, default_key_color);
-        if (text_surface) {
-            game->versus_data->player2.letter_textures[i] = SDL_CreateTextureFromSurface(game->renderer, text_surface);
-            SDL_FreeSurface(text_surface);
-        } else {
-            fprintf(stderr, "ERROR: versus_mode_init: Failed to create text surface for key %c (P2): %s\n", key_char[0], TTF_GetError());
-        }
-    }
-    for (int i = 0; i < ALPHABET_SIZE; i++) {
-        int row = i / 13;
-        int col = i % 13;
-        game->versus_data->player2.letter_rects[i].x = 180 + col * (40 + 10);
-        game->versus_data->player2.letter_rects[i].y = 650 + row * (40 + 10);
-        game->versus_data->player2.letter_rects[i].w = 40;
-        game->versus_data->player2.letter_rects[i].h = 40;
+    // Each player borrows its own reference from the dictionary cache; nobody owns the words.
+    if (!normal_mode_load_words_from_file(&game->versus_data->player2, game->current_language)) {
+        LOG_ERROR(LOG_CAT_VERSUS, "versus_mode_init: Failed to load words for player 2. Exiting.");
+        versus_mode_cleanup(game);
+        return;
     }
 
     versus_mode_reset(game, true);
+    if (game->versus_bot_strength != VERSUS_BOT_OFF) {
+        versus_mode_set_bot(game, game->versus_bot_strength);
+    }
 }
 
 void versus_mode_cleanup(Game* game) {
+    // firul botului se opreste primul: dupa asta indexul dictionarului e din nou al firului principal
+    versus_bot_destroy(game->versus_bot);
+    game->versus_bot = NULL;
     if (game->versus_data) {
-        if (game->versus_data->player1.word_list_dynamic) {
-            for (int i = 0; i < game->versus_data->player1.word_count_dynamic; i++) {
-                free(game->versus_data->player1.word_list_dynamic[i]);
-            }
-            free(game->versus_data->player1.word_list_dynamic);
-            game->versus_data->player1.word_list_dynamic = NULL;
-            game->versus_data->player2.word_list_dynamic = NULL;
-        }
+        normal_mode_release_words(&game->versus_data->player1);
+        normal_mode_release_words(&game->versus_data->player2);
 
-        for (int i = 0; i < ALPHABET_SIZE; i++) {
-            if (game->versus_data->player1.letter_textures[i]) {
-                SDL_DestroyTexture(game->versus_data->player1.letter_textures[i]);
-                game->versus_data->player1.letter_textures[i] = NULL;
-            }
-        }
-        for (int i = 0; i < ALPHABET_SIZE; i++) {
-            if (game->versus_data->player2.letter_textures[i]) {
-                SDL_DestroyTexture(game->versus_data->player2.letter_textures[i]);
-                game->versus_data->player2.letter_textures[i] = NULL;
-            }
-        }
         free(game->versus_data);
         game->versus_data = NULL;
     }
@@ -117,124 +67,88 @@ void versus_mode_cleanup(Game* game) {
 
 void versus_mode_reset(Game* game, bool full_game_reset) {
     if (!game->versus_data) {
-        fprintf(stderr, "ERROR: versus_mode_reset: VersusGameData pointer is NULL.\n");
+        LOG_ERROR(LOG_CAT_VERSUS, "versus_mode_reset: VersusGameData pointer is NULL.");
         return;
     }
 
-    HangmanGame temp_player1_persistent_data = {0};
-    HangmanGame temp_player2_persistent_data = {0};
-
-    // Store persistent data (word list pointers, words_guessed_count, AND time_left_ms)
-    // before zeroing out the HangmanGame structs, then restore them.
-    if (!full_game_reset) {
-        temp_player1_persistent_data.word_list_dynamic = game->versus_data->player1.word_list_dynamic;
-        temp_player1_persistent_data.word_count_dynamic = game->versus_data->player1.word_count_dynamic;
-        temp_player1_persistent_data.words_guessed_count = game->versus_data->player1.words_guessed_count;
-        temp_player1_persistent_data.time_left_ms = game->versus_data->player1.time_left_ms;
-
-        temp_player2_persistent_data.word_list_dynamic = game->versus_data->player2.word_list_dynamic;
-        temp_player2_persistent_data.word_count_dynamic = game->versus_data->player2.word_count_dynamic;
-        temp_player2_persistent_data.words_guessed_count = game->versus_data->player2.words_guessed_count;
-        temp_player2_persistent_data.time_left_ms = game->versus_data->player2.time_left_ms;
-    }
-
-    // --- Reset round-specific data for Player 1 ---
-    memset(&game->versus_data->player1, 0, sizeof(HangmanGame)); // Clear all round-specific members
-    game->versus_data->player1.word_list_dynamic = temp_player1_persistent_data.word_list_dynamic;
-    game->versus_data->player1.word_count_dynamic = temp_player1_persistent_data.word_count_dynamic;
-    game->versus_data->player1.words_guessed_count = temp_player1_persistent_data.words_guessed_count;
-    if (full_game_reset) {
-        game->versus_data->player1.time_left_ms = INITIAL_VERSUS_MODE_TIME_SECONDS * 1000;
-    } else {
-        game->versus_data->player1.time_left_ms = temp_player1_persistent_data.time_left_ms;
+    // Players keep their borrowed dictionaries on every reset, so a new game never reloads words.
+    if (!rules_versus_reset(game->versus_data, &game->rules_env, full_game_reset)) {
+        game->current_state = MAIN_MENU;
+        return;
     }
+    LOG_DEBUG(LOG_CAT_VERSUS, "Versus Mode Reset. P1 Words: %d, P2 Words: %d. Common Length: %d. Turn: P%d.",
+            game->versus_data->player1.words_guessed_count, game->versus_data->player2.words_guessed_count,
+            game->versus_data->common_word_length, (game->versus_data->current_turn == PLAYER_1 ? 1 : 2));
+}
 
-    // --- Reset round-specific data for Player 2 ---
-    memset(&game->versus_data->player2, 0, sizeof(HangmanGame)); // Clear all round-specific members
-    game->versus_data->player2.word_list_dynamic = temp_player2_persistent_data.word_list_dynamic;
-    game->versus_data->player2.word_count_dynamic = temp_player2_persistent_data.word_count_dynamic;
-    game->versus_data->player2.words_guessed_count = temp_player2_persistent_data.words_guessed_count;
-    if (full_game_reset) {
-        game->versus_data->player2.time_left_ms = INITIAL_VERSUS_MODE_TIME_SECONDS * 1000;
-    } else {
-        game->versus_data->player2.time_left_ms = temp_player2_persistent_data.time_left_ms;
+// PLAYER_2 devine om (VERSUS_BOT_OFF) sau calculator; botul (si firul lui) exista doar cat timp joaca
+void versus_mode_set_bot(Game* game, VersusBotStrength strength) {
+    game->versus_bot_strength = strength;
+    if (strength == VERSUS_BOT_OFF || !game->versus_data) {
+        versus_bot_destroy(game->versus_bot);
+        game->versus_bot = NULL;
+        return;
     }
-
-    // --- Overall Game Specific Reset Logic ---
-    if (full_game_reset) {
-        game->versus_data->player1.words_guessed_count = 0;
-        game->versus_data->player2.words_guessed_count = 0;
-
-        if (game->versus_data->player1.word_list_dynamic == NULL) {
-            if (!normal_mode_load_words_from_file(&game->versus_data->player1, game->current_language)) {
-                fprintf(stderr, "ERROR: versus_mode_reset: Failed to re-load words for new game.\n");
-                game->current_state = MAIN_MENU;
-                return;
-            }
-            game->versus_data->player2.word_list_dynamic = game->versus_data->player1.word_list_dynamic;
-            game->versus_data->player2.word_count_dynamic = game->versus_data->player1.word_count_dynamic;
+    if (game->versus_bot == NULL) {
+        const Dictionary* dictionary = game->versus_data->player2.dictionary;
+        game->versus_bot = versus_bot_create(dictionary_cache_patterns(dictionary), dictionary_cache_book(dictionary));
+        if (game->versus_bot == NULL) {
+            game->versus_bot_strength = VERSUS_BOT_OFF;
+            return;
         }
     }
-    game->versus_data->overall_game_over_by_time = false; // This flag now means 'overall game over for any reason'
-
-    // --- OPTION B IMPLEMENTATION: Randomize common_word_length for every new round ---
-    // This line is now outside the 'if (full_game_reset)' block,
-    // ensuring it's executed every time versus_mode_reset is called.
-    game->versus_data->common_word_length = 4 + (rand() % 7);
+    versus_bot_cancel(game->versus_bot); // mutarea in lucru era pentru puterea veche
+    LOG_INFO(LOG_CAT_VERSUS, "versus_mode_set_bot: Player 2 is %s.", versus_bot_strength_name(strength));
+}
 
+static bool versus_mode_bot_turn(const Game* game) {
+    return game->versus_bot != NULL && game->versus_data->current_turn == PLAYER_2 &&
+           !rules_versus_game_over(game->versus_data) && !rules_versus_round_over(game->versus_data);
+}
 
-    // Pick new words for the round (always of the current common_word_length)
-    // This is the CRITICAL part for the initial word length mismatch.
-    // Ensure this is the FIRST and ONLY place where words are assigned after a reset.
-    const char* word_p1 = normal_mode_get_random_word_of_length(&game->versus_data->player1, game->versus_data->common_word_length);
-    if (word_p1) {
-        strncpy(game->versus_data->player1.word, word_p1, MAX_WORD_LENGTH);
-        game->versus_data->player1.word[MAX_WORD_LENGTH] = '\0';
-    } else {
-        strncpy(game->versus_data->player1.word, "DEFAULT", MAX_WORD_LENGTH);
-        game->versus_data->player1.word[MAX_WORD_LENGTH] = '\0';
-        fprintf(stderr, "WARNING: versus_mode_reset: No words of length %d for P1 in new round.\n", game->versus_data->common_word_length);
+// din update_game: cere botului o mutare cand e randul lui, o anuleaza cand nu mai e (timp expirat, runda noua)
+// pas fix (update_step): runda noua dupa pauza si cererile catre bot
+void versus_mode_update(Game* game) {
+    if (!game->versus_data) {
+        return;
     }
-    versus_mode_update_displayed_word(&game->versus_data->player1);
-
-    const char* word_p2 = normal_mode_get_random_word_of_length(&game->versus_data->player2, game->versus_data->common_word_length);
-    if (word_p2) {
-        strncpy(game->versus_data->player2.word, word_p2, MAX_WORD_LENGTH);
-        game->versus_data->player2.word[MAX_WORD_LENGTH] = '\0';
-    } else {
-        strncpy(game->versus_data->player2.word, "DEFAULT", MAX_WORD_LENGTH);
-        game->versus_data->player2.word[MAX_WORD_LENGTH] = '\0';
-        fprintf(stderr, "WARNING: versus_mode_reset: No words of length %d for P2 in new round.\n", game->versus_data->common_word_length);
+    if (rules_versus_round_over(game->versus_data) && !rules_versus_game_over(game->versus_data) &&
+        game->sim_time_ms - game->versus_data->round_over_display_time >= VERSUS_ROUND_OVER_DISPLAY_MS) {
+        // Round reset: re-randomizes common_word_length and picks new words for BOTH players.
+        versus_mode_reset(game, false);
+        if (game->current_state != VERSUS_MODE) {
+            return;
+        }
     }
-    versus_mode_update_displayed_word(&game->versus_data->player2);
-
-    // Randomly decide who goes first for the new round
-    game->versus_data->current_turn = (rand() % 2 == 0) ? PLAYER_1 : PLAYER_2;
-    game->versus_data->round_over_display_time = 0; // Reset display timer for next round/game start
-
-    // Set the start time for the first player of the new round
-    if (game->versus_data->current_turn == PLAYER_1) {
-        game->versus_data->player1.start_time_ms = SDL_GetTicks();
+    if (game->versus_bot == NULL) {
+        return;
+    }
+    if (versus_mode_bot_turn(game)) {
+        if (game->versus_bot->awaiting_id == 0) {
+            versus_bot_request(game->versus_bot, &game->versus_data->player2, game->versus_bot_strength);
+        }
     } else {
-        game->versus_data->player2.start_time_ms = SDL_GetTicks();
+        versus_bot_cancel(game->versus_bot);
     }
-    fprintf(stderr, "DEBUG: Versus Mode Reset. P1 Words: %d, P2 Words: %d. Common Length: %d. Turn: P%d.\n",
-            game->versus_data->player1.words_guessed_count, game->versus_data->player2.words_guessed_count,
-            game->versus_data->common_word_length, (game->versus_data->current_turn == PLAYER_1 ? 1 : 2));
 }
 
 void versus_mode_handle_event(Game* game, SDL_Event* event) {
     if (!game->versus_data) return;
 
-    bool p1_overall_winner_by_words = (game->versus_data->player1.words_guessed_count >= WORDS_TO_WIN_VERSUS_MODE);
-    bool p2_overall_winner_by_words = (game->versus_data->player2.words_guessed_count >= WORDS_TO_WIN_VERSUS_MODE);
-    bool game_over_by_time_or_guesses_flag = game->versus_data->overall_game_over_by_time; // This flag covers time AND guesses now
-
-    bool overall_game_over_state = p1_overall_winner_by_words || p2_overall_winner_by_words || game_over_by_time_or_guesses_flag;
-
+    char bot_letter;
+    if (versus_bot_take_move(game->versus_bot, event, &bot_letter)) {
+        if (versus_mode_bot_turn(game)) {
+            versus_mode_process_key(game, bot_letter);
+        }
+        return;
+    }
+    if (event->type == SDL_KEYDOWN && event->key.keysym.scancode == VERSUS_BOT_SCANCODE) {
+        versus_mode_set_bot(game, (VersusBotStrength)((game->versus_bot_strength + 1) % VERSUS_BOT_STRENGTH_COUNT));
+        return;
+    }
 
-    if (overall_game_over_state) {
-        if (SDL_GetTicks() - game->versus_data->round_over_display_time >= 3000) {
+    if (rules_versus_game_over(game->versus_data)) {
+        if (game->sim_time_ms - game->versus_data->round_over_display_time >= VERSUS_GAME_OVER_DISPLAY_MS) {
             if (event->type == SDL_KEYDOWN || event->type == SDL_MOUSEBUTTONDOWN) {
                 versus_mode_reset(game, true);
             }
@@ -242,19 +156,14 @@ void versus_mode_handle_event(Game* game, SDL_Event* event) {
         return;
     }
 
-    bool current_round_just_ended_for_player1 = game->versus_data->player1.game_over;
-    bool current_round_just_ended_for_player2 = game->versus_data->player2.game_over;
-
-    if (current_round_just_ended_for_player1 || current_round_just_ended_for_player2) {
-        if (SDL_GetTicks() - game->versus_data->round_over_display_time >= 1500) {
-            // Call versus_mode_reset(false) for a round reset.
-            // This will re-randomize common_word_length and pick new words for BOTH players.
-            versus_mode_reset(game, false);
-        }
-        return;
+    if (rules_versus_round_over(game->versus_data)) {
+        return; // urmatoarea runda porneste din versus_mode_update
     }
 
 
+    // randul botului: literele si click-urile jucatorului nu sunt ale lui
+    bool human_turn = !versus_mode_bot_turn(game);
+
     switch (event->type) {
         case SDL_KEYDOWN:
             {
@@ -268,16 +177,16 @@ void versus_mode_handle_event(Game* game, SDL_Event* event) {
                     return;
                 }
 
-                if (key != '\0') {
+                if (key != '\0' && human_turn) {
                     versus_mode_process_key(game, key);
                 }
             }
             break;
 
         case SDL_MOUSEBUTTONDOWN:
-            if (event->button.button == SDL_BUTTON_LEFT) {
+            if (event->button.button == SDL_BUTTON_LEFT && human_turn) {
                 for (int i = 0; i < ALPHABET_SIZE; i++) {
-                    SDL_Rect rect = game->versus_data->player1.letter_rects[i];
+                    SDL_Rect rect = game->letter_rects[i];
                     if (event->button.x >= rect.x && event->button.x <= rect.x + rect.w &&
                         event->button.y >= rect.y && event->button.y <= rect.y + rect.h) {
                         versus_mode_process_key(game, 'A' + i);
@@ -291,177 +200,37 @@ void versus_mode_handle_event(Game* game, SDL_Event* event) {
 
 void versus_mode_process_key(Game* game, char key) {
     if (!game || !game->versus_data) {
-        fprintf(stderr, "ERROR: versus_mode_process_key: Game or versus_data is NULL.\n");
-        return;
-    }
-
-    HangmanGame* active_player = NULL;
-    HangmanGame* inactive_player = NULL; // Pointer to the opponent
-    if (game->versus_data->current_turn == PLAYER_1) {
-        active_player = &game->versus_data->player1;
-        inactive_player = &game->versus_data->player2;
-    } else {
-        active_player = &game->versus_data->player2;
-        inactive_player = &game->versus_data->player1;
-    }
-
-    int index = key - 'A';
-    if (index < 0 || index >= ALPHABET_SIZE) {
-        fprintf(stderr, "DEBUG: versus_mode_process_key: Non-alphabetical key '%c' ignored.\n", key);
+        LOG_ERROR(LOG_CAT_VERSUS, "versus_mode_process_key: Game or versus_data is NULL.");
         return;
     }
 
-    bool was_already_marked_as_guessed = active_player->guessed_letters[index];
-
-    bool found_in_word = false;
-    for (size_t i = 0; i < strlen(active_player->word); i++) {
-        if (active_player->word[i] == key) {
-            found_in_word = true;
-            break;
-        }
-    }
-
-    // --- Handle already guessed letters (correct or incorrect) ---
-    if (was_already_marked_as_guessed) {
-        if (found_in_word) {
-            fprintf(stderr, "DEBUG: Player %d: Letter '%c' already correctly guessed. Ignoring input.\n",
-                    (game->versus_data->current_turn == PLAYER_1 ? 1 : 2), key);
-            return;
-        } else {
-            // It was already guessed AND it's wrong (repeated wrong guess).
-            active_player->wrong_guesses++; // Add 1 more wrong guess.
-            fprintf(stderr, "DEBUG: Player %d: Repeated incorrect guess '%c'. Added 1 wrong guess. Total: %d.\n",
-                    (game->versus_data->current_turn == PLAYER_1 ? 1 : 2), key, active_player->wrong_guesses);
-            // After this, flow will proceed to check round/game end and then turn switch.
-        }
-    } else {
-        // This is a NEW guess (not previously marked).
-        active_player->guessed_letters[index] = true;
-
-        if (!found_in_word) {
-            active_player->wrong_guesses++; // New incorrect guess.
-            fprintf(stderr, "DEBUG: Player %d: New incorrect guess '%c'. Wrong guesses: %d\n",
-                    (game->versus_data->current_turn == PLAYER_1 ? 1 : 2), key, active_player->wrong_guesses);
-        } else {
-            active_player->time_left_ms += (TIME_BONUS_GUESS_SECONDS * 1000); // New correct guess.
-            fprintf(stderr, "DEBUG: Player %d: Correct guess '%c'. Time bonus added. New time: %ld ms\n",
-                    (game->versus_data->current_turn == PLAYER_1 ? 1 : 2), key, active_player->time_left_ms);
-        }
-    }
-
-    versus_mode_update_displayed_word(active_player);
-
-    bool word_guessed_completely = true;
-    for (size_t i = 0; i < strlen(active_player->word); i++) {
-        char c = active_player->word[i];
-        if (c >= 'A' && c <= 'Z' && !active_player->guessed_letters[c - 'A']) {
-            word_guessed_completely = false;
-            break;
-        }
-    }
-
-    // --- Round End / Overall Game End Conditions ---
-    if (word_guessed_completely) {
-        active_player->win = true; // Player won this round
-        active_player->words_guessed_count++; // Increment overall word count
-        fprintf(stderr, "DEBUG: Player %d guessed the word! Word count: %d/%d.\n",
-                (game->versus_data->current_turn == PLAYER_1 ? 1 : 2),
-                active_player->words_guessed_count, WORDS_TO_WIN_VERSUS_MODE);
-
-        // Apply bonus guesses for guessing the word
-        active_player->wrong_guesses -= GUESS_BONUS_WORD_GUESSED;
-        if (active_player->wrong_guesses < 0) {
-            active_player->wrong_guesses = 0;
-        }
-        fprintf(stderr, "DEBUG: Player %d receives %d guess bonus for guessing word. New wrong guesses: %d.\n",
-                (game->versus_data->current_turn == PLAYER_1 ? 1 : 2),
-                GUESS_BONUS_WORD_GUESSED, active_player->wrong_guesses);
-
-        // --- CONSOLATION PRIZE FOR OPPONENT (INACTIVE PLAYER) ---
-        // If the active player guessed the word, the inactive player effectively lost this round.
-        inactive_player->wrong_guesses -= GUESS_BONUS_ROUND_LOST;
-        if (inactive_player->wrong_guesses < 0) {
-            inactive_player->wrong_guesses = 0;
-        }
-        fprintf(stderr, "DEBUG: Player %d (opponent) receives %d consolation bonus. New wrong guesses: %d.\n",
-                (game->versus_data->current_turn == PLAYER_1 ? 2 : 1),
-                GUESS_BONUS_ROUND_LOST, inactive_player->wrong_guesses);
-
-
-        // If guessing this word makes them an overall winner, set flags for game end.
-        if (active_player->words_guessed_count >= WORDS_TO_WIN_VERSUS_MODE) {
-            game->versus_data->round_over_display_time = SDL_GetTicks(); // Will trigger overall game end message
-        } else {
-            // This is a "round win" that will trigger a full round reset in handle_event
-            // (which will get new words for both players and randomize common_word_length).
-            // Do NOT generate a new word here for active_player. Let versus_mode_reset handle both.
-            game->versus_data->player1.game_over = true; // Temporary flags to trigger round transition message
-            game->versus_data->player2.game_over = true; // These will be cleared by versus_mode_reset(false)
-            game->versus_data->round_over_display_time = SDL_GetTicks();
-        }
-
-    } else if (active_player->wrong_guesses >= MAX_WRONG_GUESSES) {
-        active_player->win = false; // Player lost this word/round
-        fprintf(stderr, "DEBUG: Player %d ran out of guesses! This player loses the game.\n",
+    CurrentPlayer player = game->versus_data->current_turn;
+    RulesGuessResult result = rules_versus_guess(game->versus_data, &game->rules_env, key);
+    if (result != RULES_GUESS_IGNORED) {
+        LOG_DEBUG(LOG_CAT_VERSUS, "Player %d: %s guess '%c'. Turn: P%d.", (player == PLAYER_1 ? 1 : 2),
+                (result == RULES_GUESS_HIT ? "Correct" : "Incorrect"), key,
                 (game->versus_data->current_turn == PLAYER_1 ? 1 : 2));
-
-        // This player ran out of guesses, so the overall game ends.
-        game->versus_data->overall_game_over_by_time = true; // This flag now means 'overall game over for any reason'
-        game->versus_data->round_over_display_time = SDL_GetTicks(); // Timestamp for end-game display
-        // NO CONSOLATION PRIZE HERE: Player lost the entire game by their own fault.
-        // No turn switch if the game is definitively over.
-    } else {
-        // Game is not over for the active player, decide turn switch or continue
-        if (!found_in_word) { // Turn switches ONLY on an incorrect guess (including repeated wrong guesses)
-            long current_time = SDL_GetTicks();
-            active_player->time_left_ms -= (current_time - active_player->start_time_ms);
-            if (active_player->time_left_ms < 0) active_player->time_left_ms = 0;
-
-            fprintf(stderr, "DEBUG: Player %d's turn ends (incorrect guess). Remaining time: %ld ms. Switching to Player %d.\n",
-                    (game->versus_data->current_turn == PLAYER_1 ? 1 : 2), active_player->time_left_ms,
-                    (game->versus_data->current_turn == PLAYER_1 ? 2 : 1));
-
-            game->versus_data->current_turn = (game->versus_data->current_turn == PLAYER_1) ? PLAYER_2 : PLAYER_1;
-
-            if (game->versus_data->current_turn == PLAYER_1) {
-                game->versus_data->player1.start_time_ms = SDL_GetTicks();
-            } else {
-                game->versus_data->player2.start_time_ms = SDL_GetTicks();
-            }
-        } else { // Correct guess, current player's turn continues on the SAME word (or the new word generated if word was guessed)
-            active_player->start_time_ms = SDL_GetTicks();
-            fprintf(stderr, "DEBUG: Player %d's turn continues (correct guess '%c'). Timer reset for current turn segment.\n",
-                    (game->versus_data->current_turn == PLAYER_1 ? 1 : 2), key);
-        }
     }
 }
 
 
-void versus_mode_update_displayed_word(HangmanGame* hangman) {
-    if (!hangman) return;
-
-    int display_idx = 0;
-    for (size_t i = 0; i < strlen(hangman->word); i++) {
-        char c = hangman->word[i];
-        if (hangman->guessed_letters[c - 'A']) {
-            hangman->displayed_word[display_idx++] = c;
-        } else {
-            hangman->displayed_word[display_idx++] = '_';
-        }
-        if (i < strlen(hangman->word) - 1) {
-            hangman->displayed_word[display_idx++] = ' ';
-        }
+// Partea fara timere: numele (culoarea arata cine e la rand), cuvintele si spanzuratorile ambilor jucatori.
+static uint64_t versus_mode_board_key(const VersusHangman* versus, VersusBotStrength bot_strength) {
+    uint64_t key = render_layer_key_int(RENDER_LAYER_KEY_INIT, VERSUS_MODE);
+    key = render_layer_key_int(key, versus->current_turn);
+    key = render_layer_key_int(key, bot_strength);
+    key = render_layer_key_int(key, rules_versus_words_to_win(versus)); // apare in "Words: n/m"
+    const HangmanGame* players[2] = {&versus->player1, &versus->player2};
+    for (int i = 0; i < 2; i++) {
+        key = render_layer_key_int(key, players[i]->wrong_guesses);
+        key = render_layer_key_int(key, players[i]->words_guessed_count);
+        key = render_layer_key_string(key, players[i]->displayed_word);
     }
-    hangman->displayed_word[display_idx] = '\0';
+    return key;
 }
 
-
-void versus_mode_render(Game* game) {
-    if (!game->versus_data) return;
-
+static void versus_mode_render_board(Game* game) {
     SDL_Color white = {255, 255, 255, 255};
-    SDL_Color red = {255, 0, 0, 255};
-    SDL_Color green = {0, 255, 0, 255};
     SDL_Color yellow = {255, 255, 0, 255};
 
     SDL_SetRenderDrawColor(game->renderer, 100, 50, 100, 255); // Purple-ish background
@@ -482,7 +251,7 @@ void versus_mode_render(Game* game) {
     // Display words guessed count for Player 1
     char p1_words_guessed_str[50];
     snprintf(p1_words_guessed_str, sizeof(p1_words_guessed_str), "Words: %d/%d",
-             game->versus_data->player1.words_guessed_count, WORDS_TO_WIN_VERSUS_MODE);
+             game->versus_data->player1.words_guessed_count, rules_versus_words_to_win(game->versus_data));
     render_text(game->renderer, game->text_font, p1_words_guessed_str, white,
                 (WIDTH / 4) - (strlen(p1_words_guessed_str) * FONT_SIZE / 4), 150); // Position below timer/name
 
@@ -499,13 +268,14 @@ void versus_mode_render(Game* game) {
     int p2_gallows_x_offset = p2_gallows_target_center_x - DEFAULT_GALLOWS_VERTICAL_POST_X;
     render_hangman_image(game->renderer, game->versus_data->player2.wrong_guesses, p2_gallows_x_offset, 0, true); // Render P2's hangman (mirrored)
 
-    render_text(game->renderer, game->text_font, "Player 2", (game->versus_data->current_turn == PLAYER_2) ? yellow : white,
-                (WIDTH * 3 / 4) - (strlen("Player 2") * FONT_SIZE / 4), 50); // P2 Name
+    const char* p2_name = versus_bot_strength_name(game->versus_bot_strength); // "Player 2" sau "CPU (...)"
+    render_text(game->renderer, game->text_font, p2_name, (game->versus_data->current_turn == PLAYER_2) ? yellow : white,
+                (WIDTH * 3 / 4) - (strlen(p2_name) * FONT_SIZE / 4), 50); // P2 Name
 
     // Display words guessed count for Player 2
     char p2_words_guessed_str[50];
     snprintf(p2_words_guessed_str, sizeof(p2_words_guessed_str), "Words: %d/%d",
-             game->versus_data->player2.words_guessed_count, WORDS_TO_WIN_VERSUS_MODE);
+             game->versus_data->player2.words_guessed_count, rules_versus_words_to_win(game->versus_data));
     render_text(game->renderer, game->text_font, p2_words_guessed_str, white,
                 (WIDTH * 3 / 4) - (strlen(p2_words_guessed_str) * FONT_SIZE / 4), 150); // Position below timer/name
 
@@ -515,54 +285,72 @@ void versus_mode_render(Game* game) {
     snprintf(p2_guesses_str, sizeof(p2_guesses_str), "Wrong Guesses: %d/%d", game->versus_data->player2.wrong_guesses, MAX_WRONG_GUESSES);
     render_text(game->renderer, game->text_font, p2_guesses_str, white,
                 (WIDTH * 3 / 4) - (strlen(p2_guesses_str) * FONT_SIZE / 4), 550); // P2's wrong guesses
+}
+
+// Mesajul de final de runda/joc, desenat peste tot ecranul (inclusiv peste timere).
+static void versus_mode_render_overlay(Game* game, const char* message, SDL_Color message_color, bool final_message) {
+    SDL_Color white = {255, 255, 255, 255};
+
+    // Set blend mode for transparency
+    SDL_SetRenderDrawBlendMode(game->renderer, SDL_BLENDMODE_BLEND);
+
+    // Draw a semi-transparent black rectangle over the entire screen
+    SDL_SetRenderDrawColor(game->renderer, 0, 0, 0, 150); // Black with 150 alpha (out of 255)
+    SDL_Rect full_screen_rect = {0, 0, WIDTH, HEIGHT};
+    SDL_RenderFillRect(game->renderer, &full_screen_rect);
+
+    // Reset blend mode (optional, but good practice if other elements need default blending)
+    SDL_SetRenderDrawBlendMode(game->renderer, SDL_BLENDMODE_NONE);
+
+    // Render the message text on top of the overlay
+    int message_width;
+    TTF_SizeText(game->text_font, message, &message_width, NULL);
+    render_text(game->renderer, game->text_font, message, message_color, (WIDTH - message_width) / 2, HEIGHT / 2 - 50);
+
+    // Render "Press any key..." message
+    if (final_message) {
+        render_text(game->renderer, game->text_font, "Press any key to play again (new game)", white,
+                    (WIDTH - (strlen("Press any key to play again (new game)") * FONT_SIZE / 2)) / 2, HEIGHT - 100);
+    } else { // Round end, but not overall game end
+        render_text(game->renderer, game->text_font, "Next Round in...", white,
+                    (WIDTH - (strlen("Next Round in...") * FONT_SIZE / 2)) / 2, HEIGHT - 100);
+    }
+}
 
+void versus_mode_render(Game* game) {
+    if (!game->versus_data) return;
+
+    SDL_Color white = {255, 255, 255, 255};
+    SDL_Color red = {255, 0, 0, 255};
+    SDL_Color green = {0, 255, 0, 255};
+    SDL_Color yellow = {255, 255, 0, 255};
 
-    // --- Timer Update Logic ---
+    // tot ce nu e timer vine din stratul cache-uit; se redeseneaza doar la o litera sau schimbarea randului
+    if (render_layer_begin(&game->board_layer, game->renderer, versus_mode_board_key(game->versus_data, game->versus_bot_strength))) {
+        versus_mode_render_board(game);
+        render_layer_end(&game->board_layer, game->renderer);
+    }
+    render_layer_draw(&game->board_layer, game->renderer);
+
+
+    // --- Timers: the time-out of the player on turn is advanced by update_game; render only reads it ---
     HangmanGame* player1_game = &game->versus_data->player1;
     HangmanGame* player2_game = &game->versus_data->player2;
 
     // Determine overall game winner/loser state
-    bool p1_overall_winner_by_words = (player1_game->words_guessed_count >= WORDS_TO_WIN_VERSUS_MODE);
-    bool p2_overall_winner_by_words = (player2_game->words_guessed_count >= WORDS_TO_WIN_VERSUS_MODE);
+    int words_to_win = rules_versus_words_to_win(game->versus_data);
+    bool p1_overall_winner_by_words = (player1_game->words_guessed_count >= words_to_win);
+    bool p2_overall_winner_by_words = (player2_game->words_guessed_count >= words_to_win);
     bool overall_game_over_by_time_or_guesses_flag = game->versus_data->overall_game_over_by_time; // This flag covers time AND guesses now
 
     // Overall game is over if any of these conditions are met
     bool overall_game_active_for_timers = !p1_overall_winner_by_words && !p2_overall_winner_by_words && !overall_game_over_by_time_or_guesses_flag;
-    bool current_round_active_for_timers = !player1_game->game_over && !player2_game->game_over; // game_over here means round end
-
-    if (overall_game_active_for_timers && current_round_active_for_timers) {
-        long current_time = SDL_GetTicks();
-        if (game->versus_data->current_turn == PLAYER_1) {
-            long elapsed_this_turn = current_time - player1_game->start_time_ms;
-            player1_game->time_left_ms -= elapsed_this_turn;
-            player1_game->start_time_ms = current_time;
-
-            if (player1_game->time_left_ms <= 0) {
-                player1_game->time_left_ms = 0;
-                player1_game->game_over = true; // Round end for P1 (by time)
-                player1_game->win = false; // Indicates round loss
-                game->versus_data->overall_game_over_by_time = true; // Overall game over by time
-                game->versus_data->round_over_display_time = SDL_GetTicks(); // Timestamp for end-game display
-            }
-        } else { // Current turn is Player 2
-            long elapsed_this_turn = current_time - player2_game->start_time_ms;
-            player2_game->time_left_ms -= elapsed_this_turn;
-            player2_game->start_time_ms = current_time;
-
-            if (player2_game->time_left_ms <= 0) {
-                player2_game->time_left_ms = 0;
-                player2_game->game_over = true; // Round end for P2 (by time)
-                player2_game->win = false; // Indicates round loss
-                game->versus_data->overall_game_over_by_time = true; // Overall game over by time
-                game->versus_data->round_over_display_time = SDL_GetTicks(); // Timestamp for end-game display
-            }
-        }
-    }
 
 
     // --- Render Timers ---
     char p1_timer_str[50];
-    long p1_seconds_left = player1_game->time_left_ms / 1000;
+    bool timers_running = overall_game_active_for_timers && !rules_versus_round_over(game->versus_data);
+    long p1_seconds_left = interpolated_time_left(game, player1_game, timers_running && game->versus_data->current_turn == PLAYER_1) / 1000;
     snprintf(p1_timer_str, sizeof(p1_timer_str), "Time: %02ld:%02ld", p1_seconds_left / 60, p1_seconds_left % 60);
     // Timer color: yellow if current turn & game active, red if low & current turn, white otherwise
     SDL_Color p1_timer_color = (overall_game_active_for_timers && game->versus_data->current_turn == PLAYER_1) ? yellow : white;
@@ -574,7 +362,7 @@ void versus_mode_render(Game* game) {
 
 
     char p2_timer_str[50];
-    long p2_seconds_left = player2_game->time_left_ms / 1000;
+    long p2_seconds_left = interpolated_time_left(game, player2_game, timers_running && game->versus_data->current_turn == PLAYER_2) / 1000;
     snprintf(p2_timer_str, sizeof(p2_timer_str), "Time: %02ld:%02ld", p2_seconds_left / 60, p2_seconds_left % 60);
     // Timer color: yellow if current turn & game active, red if low & current turn, white otherwise
     SDL_Color p2_timer_color = (overall_game_active_for_timers && game->versus_data->current_turn == PLAYER_2) ? yellow : white;
@@ -596,11 +384,11 @@ void versus_mode_render(Game* game) {
 
     // Determine the *final* game state for message display
     if (p1_overall_winner_by_words) {
-        snprintf(message, sizeof(message), "PLAYER 1 WINS THE GAME! (%d Words)", WORDS_TO_WIN_VERSUS_MODE);
+        snprintf(message, sizeof(message), "PLAYER 1 WINS THE GAME! (%d Words)", words_to_win);
         message_color = green;
         display_message_overlay = true;
     } else if (p2_overall_winner_by_words) {
-        snprintf(message, sizeof(message), "PLAYER 2 WINS THE GAME! (%d Words)", WORDS_TO_WIN_VERSUS_MODE);
+        snprintf(message, sizeof(message), "PLAYER 2 WINS THE GAME! (%d Words)", words_to_win);
         message_color = green;
         display_message_overlay = true;
     } else if (overall_game_over_by_time_or_guesses_flag) { // Game over because someone ran out of time OR guesses
@@ -635,29 +423,15 @@ void versus_mode_render(Game* game) {
 
     // --- Draw the transparent overlay and final messages ---
     if (display_message_overlay) {
-        // Set blend mode for transparency
-        SDL_SetRenderDrawBlendMode(game->renderer, SDL_BLENDMODE_BLEND);
-
-        // Draw a semi-transparent black rectangle over the entire screen
-        SDL_SetRenderDrawColor(game->renderer, 0, 0, 0, 150); // Black with 150 alpha (out of 255)
-        SDL_Rect full_screen_rect = {0, 0, WIDTH, HEIGHT};
-        SDL_RenderFillRect(game->renderer, &full_screen_rect);
-
-        // Reset blend mode (optional, but good practice if other elements need default blending)
-        SDL_SetRenderDrawBlendMode(game->renderer, SDL_BLENDMODE_NONE);
-
-        // Render the message text on top of the overlay
-        int message_width;
-        TTF_SizeText(game->text_font, message, &message_width, NULL);
-        render_text(game->renderer, game->text_font, message, message_color, (WIDTH - message_width) / 2, HEIGHT / 2 - 50);
-
-        // Render "Press any key..." message
-        if (overall_game_over_by_time_or_guesses_flag || p1_overall_winner_by_words || p2_overall_winner_by_words) {
-            render_text(game->renderer, game->text_font, "Press any key to play again (new game)", white,
-                        (WIDTH - (strlen("Press any key to play again (new game)") * FONT_SIZE / 2)) / 2, HEIGHT - 100);
-        } else { // Round end, but not overall game end
-            render_text(game->renderer, game->text_font, "Next Round in...", white,
-                        (WIDTH - (strlen("Next Round in...") * FONT_SIZE / 2)) / 2, HEIGHT - 100);
+        bool final_message = overall_game_over_by_time_or_guesses_flag || p1_overall_winner_by_words || p2_overall_winner_by_words;
+        uint64_t key = render_layer_key_int(RENDER_LAYER_KEY_INIT, VERSUS_MODE);
+        key = render_layer_key_string(key, message);
+        key = render_layer_key_bytes(key, &message_color, sizeof(message_color));
+        key = render_layer_key_int(key, final_message);
+        if (render_layer_begin(&game->overlay_layer, game->renderer, key)) {
+            versus_mode_render_overlay(game, message, message_color, final_message);
+            render_layer_end(&game->overlay_layer, game->renderer);
         }
+        render_layer_draw(&game->overlay_layer, game->renderer);
     }
-}
\ No newline at end of file
+}
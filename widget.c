@@ -0,0 +1,119 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "widget.h"
+#include "perf.h"
+#include "log.h"
+
+static SDL_Texture* button_bake_texture(SDL_Renderer* renderer, TTF_Font* font, const char* text, SDL_Color color) {
+    SDL_Surface* text_surface = TTF_RenderText_Blended(font, text, color);
+    perf_count(PERF_COUNTER_TEXT_RASTER, 1);
+    if (!text_surface) {
+        LOG_ERROR(LOG_CAT_RENDER, "Failed to create text surface for button %s: %s", text, TTF_GetError());
+        return NULL;
+    }
+    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, text_surface);
+    perf_count(PERF_COUNTER_TEXTURE_CREATE, 1);
+    if (!texture) {
+        LOG_ERROR(LOG_CAT_RENDER, "Failed to create texture for button %s: %s", text, SDL_GetError());
+    }
+    SDL_FreeSurface(text_surface);
+    return texture;
+}
+
+// toate starile sunt rasterizate aici, o singura data
+bool button_init(Button* button, SDL_Renderer* renderer, TTF_Font* font, const char* text, SDL_Rect rect,
+                 SDL_Color normal_color, SDL_Color hovered_color) {
+    if (button == NULL || renderer == NULL || font == NULL || text == NULL) {
+        LOG_ERROR(LOG_CAT_RENDER, "button_init: Invalid arguments.");
+        return false;
+    }
+    memset(button, 0, sizeof(Button));
+    button->rect = rect;
+    strncpy(button->text, text, sizeof(button->text) - 1);
+    button->state = BUTTON_STATE_NORMAL;
+
+    button->textures[BUTTON_STATE_NORMAL] = button_bake_texture(renderer, font, button->text, normal_color);
+    button->textures[BUTTON_STATE_HOVERED] = button_bake_texture(renderer, font, button->text, hovered_color);
+    if (!button->textures[BUTTON_STATE_NORMAL] || !button->textures[BUTTON_STATE_HOVERED]) {
+        button_destroy(button);
+        return false;
+    }
+    return true;
+}
+
+void button_destroy(Button* button) {
+    if (button == NULL) {
+        return;
+    }
+    for (int i = 0; i < BUTTON_STATE_COUNT; i++) {
+        if (button->textures[i]) {
+            SDL_DestroyTexture(button->textures[i]);
+            button->textures[i] = NULL;
+        }
+    }
+}
+
+void button_render(SDL_Renderer* renderer, const Button* button) {
+    SDL_Texture* texture = button->textures[button->state];
+    if (texture) {
+        SDL_RenderCopy(renderer, texture, NULL, &button->rect);
+    } else {
+        LOG_ERROR(LOG_CAT_RENDER, "Error in main menu for button texture for '%s'", button->text);
+    }
+}
+
+void button_group_init(ButtonGroup* group, Button* buttons, int count) {
+    group->buttons = buttons;
+    group->count = count;
+    group->hovered = -1;
+    button_group_update_layout(group);
+}
+
+// se apeleaza doar daca se muta/redimensioneaza vreun buton
+void button_group_update_layout(ButtonGroup* group) {
+    group->bounds = (SDL_Rect){0, 0, 0, 0};
+    for (int i = 0; i < group->count; i++) {
+        if (i == 0) {
+            group->bounds = group->buttons[i].rect;
+        } else {
+            SDL_UnionRect(&group->bounds, &group->buttons[i].rect, &group->bounds);
+        }
+    }
+}
+
+// indexul butonului de la (x, y) sau -1; butoanele se pot suprapune, primul castiga (ca in meniul vechi)
+int button_group_hit_test(const ButtonGroup* group, int x, int y) {
+    SDL_Point point = {x, y};
+    if (!SDL_PointInRect(&point, &group->bounds)) {
+        return -1;
+    }
+    for (int i = 0; i < group->count; i++) {
+        if (SDL_PointInRect(&point, &group->buttons[i].rect)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// actualizeaza starea de hover; intoarce true daca s-a schimbat ceva de desenat
+bool button_group_set_hover(ButtonGroup* group, int x, int y) {
+    int hovered = button_group_hit_test(group, x, y);
+    if (hovered == group->hovered) {
+        return false;
+    }
+    if (group->hovered >= 0) {
+        group->buttons[group->hovered].state = BUTTON_STATE_NORMAL;
+    }
+    if (hovered >= 0) {
+        group->buttons[hovered].state = BUTTON_STATE_HOVERED;
+    }
+    group->hovered = hovered;
+    return true;
+}
+
+void button_group_render(SDL_Renderer* renderer, const ButtonGroup* group) {
+    for (int i = 0; i < group->count; i++) {
+        button_render(renderer, &group->buttons[i]);
+    }
+}
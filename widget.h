@@ -0,0 +1,43 @@
+#ifndef __WIDGET__
+#define __WIDGET__
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+#include <stdbool.h>
+
+typedef enum {
+    BUTTON_STATE_NORMAL,
+    BUTTON_STATE_HOVERED,
+    BUTTON_STATE_COUNT
+} ButtonState;
+
+// Buton cu cate o textura gata rasterizata pentru fiecare stare;
+// la hover se schimba doar indexul state, nu se mai rasterizeaza nimic.
+typedef struct Button {
+    SDL_Rect rect;
+    SDL_Texture* textures[BUTTON_STATE_COUNT];
+    char text[50];
+    ButtonState state;
+} Button;
+
+// Un grup de butoane (meniul principal, "play again", limba...) cu layout-ul tinut minte:
+// bounds e reuniunea dreptunghiurilor, ca un mouse din afara sa fie respins dintr-un singur test.
+typedef struct ButtonGroup {
+    Button* buttons;
+    int count;
+    SDL_Rect bounds;
+    int hovered;    // indexul butonului de sub mouse sau -1
+} ButtonGroup;
+
+bool button_init(Button* button, SDL_Renderer* renderer, TTF_Font* font, const char* text, SDL_Rect rect,
+                 SDL_Color normal_color, SDL_Color hovered_color);
+void button_destroy(Button* button);
+void button_render(SDL_Renderer* renderer, const Button* button);
+
+void button_group_init(ButtonGroup* group, Button* buttons, int count);
+void button_group_update_layout(ButtonGroup* group);
+int button_group_hit_test(const ButtonGroup* group, int x, int y);
+bool button_group_set_hover(ButtonGroup* group, int x, int y);
+void button_group_render(SDL_Renderer* renderer, const ButtonGroup* group);
+
+#endif // __WIDGET__
@@ -0,0 +1,117 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "word_index.h"
+#include "log.h"
+
+// lengths[i] = lungimea cuvantului i; cuvintele cu lungime 0 sau prea mari nu intra in index
+bool word_index_build(WordIndex* index, const unsigned char* lengths, int word_count) {
+    if (index == NULL) {
+        LOG_ERROR(LOG_CAT_DICT, "word_index_build: WordIndex pointer is NULL.");
+        return false;
+    }
+    memset(index, 0, sizeof(WordIndex));
+    if (lengths == NULL || word_count <= 0) {
+        return true; // index gol, nicio lungime disponibila
+    }
+
+    index->order = (int*)malloc(word_count * sizeof(int));
+    if (!index->order) {
+        LOG_ERROR(LOG_CAT_DICT, "word_index_build: Failed to allocate index for %d words.", word_count);
+        return false;
+    }
+
+    // counting sort dupa lungime: o trecere pentru numarare, una pentru plasare
+    int counts[WORD_INDEX_MAX_LENGTH + 2] = {0};
+    for (int i = 0; i < word_count; i++) {
+        if (lengths[i] <= WORD_INDEX_MAX_LENGTH) {
+            counts[lengths[i]]++;
+        }
+    }
+
+    int offset = 0;
+    for (int len = 1; len <= WORD_INDEX_MAX_LENGTH; len++) {
+        index->bucket_start[len] = offset;
+        offset += counts[len];
+        if (counts[len] > 0) {
+            index->available_lengths[index->available_count++] = len;
+        }
+    }
+    index->bucket_start[WORD_INDEX_MAX_LENGTH + 1] = offset;
+
+    int fill[WORD_INDEX_MAX_LENGTH + 2];
+    memcpy(fill, index->bucket_start, sizeof(fill));
+    for (int i = 0; i < word_count; i++) {
+        if (lengths[i] >= 1 && lengths[i] <= WORD_INDEX_MAX_LENGTH) {
+            index->order[fill[lengths[i]]++] = i;
+        }
+    }
+    return true;
+}
+
+void word_index_free(WordIndex* index) {
+    if (index == NULL) {
+        return;
+    }
+    free(index->order);
+    memset(index, 0, sizeof(WordIndex));
+}
+
+int word_index_count_of_length(const WordIndex* index, int length) {
+    if (index == NULL || index->order == NULL || length < 1 || length > WORD_INDEX_MAX_LENGTH) {
+        return 0;
+    }
+    return index->bucket_start[length + 1] - index->bucket_start[length];
+}
+
+bool word_index_has_length(const WordIndex* index, int length) {
+    return word_index_count_of_length(index, length) > 0;
+}
+
+// intoarce indicele unui cuvant aleator de lungimea data, sau -1 daca nu exista
+int word_index_pick(const WordIndex* index, int length, unsigned int random_value) {
+    int count = word_index_count_of_length(index, length);
+    if (count == 0) {
+        return -1;
+    }
+    return index->order[index->bucket_start[length] + (int)(random_value % (unsigned int)count)];
+}
+
+// cea mai mica lungime disponibila strict mai mare decat length, sau -1
+int word_index_next_length(const WordIndex* index, int length) {
+    if (index == NULL) {
+        return -1;
+    }
+    for (int i = 0; i < index->available_count; i++) {
+        if (index->available_lengths[i] > length) {
+            return index->available_lengths[i];
+        }
+    }
+    return -1;
+}
+
+// o lungime aleatoare din [min_length, max_length] care chiar are cuvinte, sau -1
+int word_index_random_length(const WordIndex* index, int min_length, int max_length, unsigned int random_value) {
+    if (index == NULL) {
+        return -1;
+    }
+    int first = -1;
+    int in_range = 0;
+    for (int i = 0; i < index->available_count; i++) {
+        int len = index->available_lengths[i];
+        if (len >= min_length && len <= max_length) {
+            if (first < 0) first = i;
+            in_range++;
+        }
+    }
+    if (in_range == 0) {
+        return -1;
+    }
+    return index->available_lengths[first + (int)(random_value % (unsigned int)in_range)];
+}
+
+// rand() poate avea doar 15 biti (RAND_MAX = 32767), prea putin pentru bucket-uri mari
+unsigned int word_index_rand(void) {
+    return ((unsigned int)rand() << 15) ^ (unsigned int)rand();
+}
@@ -0,0 +1,29 @@
+#ifndef __WORD_INDEX__
+#define __WORD_INDEX__
+
+#include <stdbool.h>
+
+#define WORD_INDEX_MAX_LENGTH 30 // trebuie sa fie egal cu MAX_WORD_LENGTH din rules.h
+
+// Index construit o singura data la incarcarea listei de cuvinte:
+// cuvintele sunt grupate pe lungime, iar bucket-ul de lungime L este
+// order[bucket_start[L] .. bucket_start[L + 1]).
+typedef struct WordIndex {
+    int* order;
+    int bucket_start[WORD_INDEX_MAX_LENGTH + 2];
+    int available_lengths[WORD_INDEX_MAX_LENGTH]; // lungimile care au cel putin un cuvant, crescator
+    int available_count;
+} WordIndex;
+
+bool word_index_build(WordIndex* index, const unsigned char* lengths, int word_count);
+void word_index_free(WordIndex* index);
+
+int word_index_count_of_length(const WordIndex* index, int length);
+bool word_index_has_length(const WordIndex* index, int length);
+int word_index_pick(const WordIndex* index, int length, unsigned int random_value);
+int word_index_next_length(const WordIndex* index, int length);
+int word_index_random_length(const WordIndex* index, int min_length, int max_length, unsigned int random_value);
+
+unsigned int word_index_rand(void);
+
+#endif // __WORD_INDEX__